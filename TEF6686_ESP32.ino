@@ -29,6 +29,7 @@ using fs::FS;
 #include "src/touch.h"
 #include "src/logbook.h"
 #include "src/custom_ptys.h"
+#include "src/BandMap.h"
 
 #define ROTARY_PIN_A 34
 #define ROTARY_PIN_B 36
@@ -124,10 +125,12 @@ bool scanholdflag;
 bool scanholdonsignal;
 bool scanmem;
 bool scanmute;
+bool scanrds;
 bool screenmute;
 bool screensavertriggered = false;
 bool seek;
 bool seekinit;
+bool seekstep;
 bool setextendbw;
 bool setupmode;
 bool showclock;
@@ -154,6 +157,7 @@ bool XDRScan;
 bool wifi;
 bool wificonnected;
 byte af_counterold;
+byte eon_updatecounterold;
 byte aid_counterold;
 byte af;
 byte afpagenr;
@@ -222,6 +226,7 @@ byte scanstart;
 byte scanstop;
 byte scanhold;
 byte scanmodeold;
+byte scanpistate;
 byte screensaverOptions[5] = { 0, 3, 10, 30, 60 };
 byte screensaverset;
 byte showmodulation;
@@ -332,6 +337,10 @@ int8_t USold = 0;
 int8_t LevelOffset;
 int8_t LowLevelSet;
 int8_t NTPoffset;
+int8_t seeklevelam;
+int8_t seeklevelfm;
+int8_t seeksnram;
+int8_t seeksnrfm;
 int8_t CN;
 int8_t CNold;
 int8_t VolSet;
@@ -371,6 +380,7 @@ String XDRGTK_key;
 String XDRGTKRDS;
 String XDRGTKRDSold;
 uint16_t BW;
+uint16_t bandmapfreq = BANDMAP_FM_FIRST;
 uint16_t MStatus;
 uint16_t rabbitearspi[100];  // first is for 88.1, 2nd 88.3, etc. to 107.9 MHz
 uint16_t SWMIBandPos;
@@ -450,7 +460,12 @@ unsigned long rtplustickerhold;
 unsigned long rtticker;
 unsigned long rttickerhold;
 unsigned long rotarytimer;
+unsigned long bandmapsavetimer;
+unsigned long bandmaptimer;
 unsigned long scantimer;
+unsigned long scanloggedtimer;
+unsigned long scanprogresstimer;
+unsigned long seekdrawtimer;
 unsigned long screensavertimer;
 unsigned long signalstatustimer;
 unsigned long tottimer;
@@ -467,6 +482,8 @@ struct HSV {
 };
 
 mem presets[EE_PRESETS_CNT];
+scanstat scanstats;
+seekstop seekcriteria;
 TEF6686 radio;
 ESP32Time rtc(0);
 
@@ -584,6 +601,10 @@ void setup() {
   spispeed = EEPROM.readByte(EE_BYTE_SPISPEED);
   amscansens = EEPROM.readByte(EE_BYTE_AMSCANSENS);
   fmscansens = EEPROM.readByte(EE_BYTE_FMSCANSENS);
+  seeklevelfm = EEPROM.readByte(EE_BYTE_SEEKLEVELFM);
+  seeklevelam = EEPROM.readByte(EE_BYTE_SEEKLEVELAM);
+  seeksnrfm = EEPROM.readByte(EE_BYTE_SEEKSNRFM);
+  seeksnram = EEPROM.readByte(EE_BYTE_SEEKSNRAM);
   freqfont = EEPROM.readByte(EE_BYTE_FREQFONT);
   CurrentSkin = EEPROM.readByte(EE_BYTE_SKIN);
   XDRGTKMuteScreen = EEPROM.readByte(EE_BYTE_XDRGTKMUTE);
@@ -725,6 +746,7 @@ void setup() {
 
   log_info("Starting SPIFFS...");
   SPIFFS.begin();
+  BandMap_Load();
 
   log_info("CSV carregando.");
   loadCustomPTYS();
@@ -966,6 +988,8 @@ void setup() {
     Wire.endTransmission();
   }
 
+  TunerTask_Begin();
+
   BuildDisplay();
   SelectBand();
   if (tunemode == TUNE_MEM) DoMemoryPosTune();
@@ -1032,10 +1056,7 @@ void loop() {
   }
 
   if (scandxmode) {
-    unsigned long waitTime = (scanhold == 0) ? 500 : (scanhold * 1000);
-    if (!scanholdflag) scanholdflag = (USN < fmscansens * 30) && (WAM < 230) && (OStatus < 80) && (OStatus > -80);
-    bool bypassMillisCheck = scanholdonsignal && !scanholdflag;
-    bool shouldScan = bypassMillisCheck || (!bypassMillisCheck && (millis() >= scantimer + waitTime));
+    bool shouldScan = radio.tuneDone() && ScanDwellDone();               // A channel is only judged once it has settled
 
     if (shouldScan) {
       if (scanmute && scanholdonsignal) {
@@ -1043,7 +1064,7 @@ void loop() {
         if (!screenmute) tft.drawBitmap(249, 4, Speaker, 28, 24, PrimaryColor);
         SQ = true;
       }
-      scanholdflag = false;
+      ScanDwellEnd();
       if (scanmem) {
         memorypos++;
         if (memorypos > scanstop) memorypos = scanstart;
@@ -1067,9 +1088,9 @@ void loop() {
         ShowFreq(0);
         if (XDRGTKUSB || XDRGTKTCP) DataPrint("T" + String((frequency + ConverterSet * 100) * 10) + "\n");
       }
-      scantimer = millis();
+      ScanDwellStart();
       initdxscan = false;
-    } else {
+    } else if (scanholdflag) {
       if (scanmute && scanholdonsignal) {
         radio.setUnMute();
         SQ = false;
@@ -1089,8 +1110,7 @@ void loop() {
       flashingtimer = millis();
     }
 
-    if (!scanholdflag) delay(100);
-    radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
+    ReadStatus(STATUS_MAXAGE);
 
     if (RabbitearsUser.length() && RabbitearsPassword.length() && radio.rds.region != 0 && radio.rds.correctPI != 0 && frequency >= 8810 && frequency <= 10790 && !(frequency % 10) && ((frequency / 10) % 2)) {
       byte i = (frequency / 10 - 881) / 2;
@@ -1141,25 +1161,14 @@ void loop() {
             }
           }
 
-          bool foundmemaf = false;
-          for (int x = 8750; x <= 10800; x += 10) {
-            if (rotary != 0 || digitalRead(BANDBUTTON) == LOW || digitalRead(MODEBUTTON) == LOW || digitalRead(BWBUTTON) == LOW || digitalRead(ROTARY_BUTTON) == LOW) break;
-            radio.SetFreq(x);
-            unsigned long millisold = millis();
-            while (millis() - millisold < 187) {
-              if (!screenmute && !advancedRDS) ShowModLevel();
-            }
-            if (radio.rds.correctPI == radio.getBlockA()) {
-              frequency = x;
-              foundmemaf = true;
-              break;
-            }
-          }
-
-          if (!foundmemaf) {
+          uint16_t memaf = HuntPI(radio.rds.correctPI, frequency);
+          if (memaf) {
+            frequency = memaf;
+          } else {
             frequency = freqold;
             radio.SetFreq(frequency);
           }
+          radio.clearRDS(fullsearchrds);                                  // Drop groups queued on the channels visited
 
           if (!screenmute) {
             if (advancedRDS) {
@@ -1196,50 +1205,28 @@ void loop() {
     }
 
     if (band == BAND_FM && af != 0 && radio.rds.correctPI != 0) {
-      if ((aftest && millis() >= aftimer + 3000) || ((USN > 250 || WAM > 250) && millis() >= aftimer + 1000)) {
-        aftimer = millis();
-        aftest = false;
-        frequency = radio.TestAF();
-        if (freqold != frequency) {
-          ShowFreq(0);
-          dropout = true;
-          if (radio.afmethodB) {
-            afmethodBold = true;
-            radio.clearRDS(fullsearchrds);
-          }
-          if (XDRGTKUSB || XDRGTKTCP) DataPrint("T" + String((frequency + ConverterSet * 100) * 10) + "\n");
-          if (screenmute) {
-            freqold = frequency;
-            dropout = false;
-          }
-          store = true;
+      if (aftest && millis() >= aftimer + 3000) aftest = false;
+      uint16_t affreq = radio.serviceAF(aftest || USN > 150 || WAM > 150);  // One AF measurement or PI check per call
+      if (affreq != 0) {
+        frequency = affreq;
+        ShowFreq(0);
+        dropout = true;
+        if (radio.afmethodB) {
+          afmethodBold = true;
+          radio.clearRDS(fullsearchrds);
         }
-      }
-
-      if (band == BAND_FM && millis() >= aftimer + 10000) {
-        aftimer = millis();
-        if (USN > 150 || WAM > 150) {
-          frequency = radio.TestAF();
-          if (freqold != frequency) {
-            ShowFreq(0);
-            dropout = true;
-            if (radio.afmethodB) {
-              afmethodBold = true;
-              radio.clearRDS(fullsearchrds);
-            }
-            if (XDRGTKUSB || XDRGTKTCP) DataPrint("T" + String((frequency + ConverterSet * 100) * 10) + "\n");
-            store = true;
-            if (screenmute) {
-              freqold = frequency;
-              dropout = false;
-            }
-          }
+        if (XDRGTKUSB || XDRGTKTCP) DataPrint("T" + String((frequency + ConverterSet * 100) * 10) + "\n");
+        if (screenmute) {
+          freqold = frequency;
+          dropout = false;
         }
+        store = true;
       }
     }
   }
 
   if (seek) Seek(direction);
+  if (!seek && !scandxmode && !menu) BandMapService();
 
   if ((SStatus / 10 > LowLevelSet) && !LowLevelInit && !BWtune && !menu && band < BAND_GAP) {
     if (!screenmute && !advancedRDS && !rdsstatscreen && !afscreen) {
@@ -1310,13 +1297,7 @@ void loop() {
     if (!BWtune && !menu && (screenmute || radio.rds.correctPI != 0)) readRds();
     if (millis() >= lowsignaltimer + 300) {
       lowsignaltimer = millis();
-      if (af || (!screenmute || (screenmute && (XDRGTKTCP || XDRGTKUSB)))) {
-        if (band < BAND_GAP) {
-          radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-        } else {
-          radio.getStatusAM(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-        }
-      }
+      if (af || (!screenmute || (screenmute && (XDRGTKTCP || XDRGTKUSB)))) ReadStatus(STATUS_MAXAGE);
       if (!BWtune && !menu) {
         doSquelch();
         GetData();
@@ -1324,13 +1305,7 @@ void loop() {
     }
 
   } else {
-    if (af || (!screenmute || (screenmute && (XDRGTKTCP || XDRGTKUSB)))) {
-      if (band < BAND_GAP) {
-        radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-      } else {
-        radio.getStatusAM(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-      }
-    }
+    if (af || (!screenmute || (screenmute && (XDRGTKTCP || XDRGTKUSB)))) ReadStatus(STATUS_MAXAGE);
     if (!BWtune && !menu) {
       doSquelch();
       if (millis() >= tuningtimer + 200) readRds();
@@ -3164,7 +3139,7 @@ void DoMemoryPosTune() {
     }
   }
 
-  radio.rds.stationName = stationText;
+  radio.rds.stationName = stationText.c_str();
 
   BWset = presets[memorypos].bw;
   doBW();
@@ -4222,6 +4197,11 @@ void DataPrint(String string) {
   if (XDRGTKTCP) RemoteClient.print(string);
 }
 
+void DataWrite(const char *data, size_t length) {
+  if (XDRGTKUSB) Serial.write((const uint8_t *)data, length);
+  if (XDRGTKTCP) RemoteClient.write((const uint8_t *)data, length);
+}
+
 void TuneUp() {
   aftest = true;
   aftimer = millis();
@@ -4283,7 +4263,7 @@ void TuneUp() {
       if (fmdefaultstepsize == 2 && stepsize == 0 && frequency == 8750) frequency = 8775;
       if (edgebeep) EdgeBeeper();
     }
-    radio.SetFreq(frequency);
+    radio.SetFreq(frequency, 0, seek);
   } else if (band == BAND_OIRT) {
     frequency_OIRT += temp;
     if (scandxmode) {
@@ -4295,7 +4275,7 @@ void TuneUp() {
       frequency_OIRT = LowEdgeOIRTSet;
       if (edgebeep) EdgeBeeper();
     }
-    radio.SetFreq(frequency_OIRT);
+    radio.SetFreq(frequency_OIRT, 0, seek);
   } else if (band == BAND_LW) {
     frequency_AM += temp;
     if (frequency_AM > LWHighEdgeSet) {
@@ -4334,8 +4314,10 @@ void TuneUp() {
   }
 #endif
   radio.clearRDS(fullsearchrds);
-  if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
-  if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+  if (!seek) {                                                            // Seek resets RDS Spy once it stops
+    if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
+    if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+  }
 }
 
 void TuneDown() {
@@ -4387,14 +4369,14 @@ void TuneDown() {
       if (fmdefaultstepsize == 2 && stepsize == 0 && frequency == 10800) frequency = 10790;
       if (edgebeep) EdgeBeeper();
     }
-    radio.SetFreq(frequency);
+    radio.SetFreq(frequency, 0, seek);
   } else if (band == BAND_OIRT) {
     frequency_OIRT -= temp;
     if (frequency_OIRT < LowEdgeOIRTSet) {
       frequency_OIRT = HighEdgeOIRTSet;
       if (edgebeep) EdgeBeeper();
     }
-    radio.SetFreq(frequency_OIRT);
+    radio.SetFreq(frequency_OIRT, 0, seek);
   } else if (band == BAND_LW) {
     frequency_AM -= temp;
     if (frequency_AM < LWLowEdgeSet) {
@@ -4422,8 +4404,10 @@ void TuneDown() {
     frequency_SW = frequency_AM;
   }
   radio.clearRDS(fullsearchrds);
-  if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
-  if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+  if (!seek) {                                                            // Seek resets RDS Spy once it stops
+    if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
+    if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+  }
 }
 
 void EdgeBeeper() {
@@ -4441,7 +4425,95 @@ void EdgeBeeper() {
   }
 }
 
+void ReadStatus(uint16_t maxage) {
+  const quality_ &status = radio.getStatusIfOlderThan(maxage, band >= BAND_GAP);
+  SStatus = status.level;
+  USN = status.usn;
+  WAM = status.wam;
+  OStatus = status.offset;
+  BW = status.bandwidth;
+  MStatus = status.modulation;
+  CN = status.snr;
+}
+
+// The level floor and SNR come from the seek settings (XDR command N),
+// USN from the scan sensitivity. The squelch raises the floor when on.
+void SetSeekCriteria() {
+  if (band < BAND_GAP) {
+    seekcriteria.level = seeklevelfm * 10;
+    seekcriteria.usn = fmscansens * 30 - 1;
+    seekcriteria.wam = 229;
+    seekcriteria.offset = 79;
+    seekcriteria.snr = seeksnrfm;
+  } else {
+    seekcriteria.level = seeklevelam * 10;
+    seekcriteria.usn = amscansens * 30 - 1;
+    seekcriteria.wam = 0xFFFF;
+    seekcriteria.offset = 1;
+    seekcriteria.snr = seeksnram;
+  }
+  if (usesquelch && Squelch != 920 && Squelch + 1 > seekcriteria.level) seekcriteria.level = Squelch + 1;
+}
+
+// Frequency only, for the steps of a seek; ShowFreq() follows once it stops
+void ShowSeekFreq() {
+  if (screenmute || advancedRDS || afscreen) return;
+  unsigned int freq = (band == BAND_OIRT) ? frequency_OIRT : frequency + ConverterSet * 100;
+
+  switch (freqfont) {
+    case 1: FrequencySprite.loadFont(FREQFONT1); break;
+    case 2: FrequencySprite.loadFont(FREQFONT2); break;
+    case 3: FrequencySprite.loadFont(FREQFONT3); break;
+    case 4: FrequencySprite.loadFont(FREQFONT4); break;
+    default: FrequencySprite.loadFont(FREQFONT0); break;
+  }
+
+  FrequencySprite.fillSprite(BackgroundColor);
+  FrequencySprite.setTextDatum(TR_DATUM);
+  FrequencySprite.setTextColor(FreqColor, FreqColorSmooth, false);
+  FrequencySprite.drawString(String(freq / 100) + "." + (freq % 100 < 10 ? "0" : "") + String(freq % 100) + " ", 218, -6);
+  FrequencySprite.pushSprite(46, 46);
+  FrequencySprite.unloadFont();
+}
+
+// Called from loop() while seeking: each call either returns while the last
+// step is still settling, or judges it and tunes the next one. FM steps use
+// search tuning; a channel below the level criterion is passed as soon as
+// its level is measured, without waiting for USN and WAM to settle.
 void Seek(bool mode) {
+  if (seekinit || !seek) {
+    seekstep = false;
+    seekdrawtimer = 0;
+    SetSeekCriteria();
+  }
+  if (seekstep) {
+    if (!radio.tuneDone()) {
+      const quality_ &status = radio.quality;
+      if (band >= BAND_GAP || !status.valid || (status.status & 0x3FF) < SEEK_LEVEL_TIME || status.level >= seekcriteria.level) return;
+    }
+    ReadStatus(STATUS_MAXAGE);
+    seekstep = false;
+
+    if (SStatus >= seekcriteria.level && USN <= seekcriteria.usn && WAM <= seekcriteria.wam && OStatus <= seekcriteria.offset && OStatus >= -seekcriteria.offset && CN >= seekcriteria.snr) {
+      seek = false;
+      radio.setUnMute();
+      if (!screenmute) {
+        tft.drawBitmap(249, 4, Speaker, 28, 24, GreyoutColor);
+      }
+      if (band < BAND_GAP) {
+        ShowFreq(0);
+        if (XDRGTKUSB || XDRGTKTCP) {
+          if (band == BAND_FM) DataPrint("M0\nT" + String(frequency * 10) + "\n");
+          else DataPrint("M0\nT" + String(frequency_OIRT * 10) + "\n");
+        }
+        if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
+        if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+      }
+      store = true;
+      return;
+    }
+  }
+
   radio.setMute();
   if (seekinit) {
     if (stepsize != 0) {
@@ -4457,41 +4529,17 @@ void Seek(bool mode) {
   }
   if (!mode) TuneDown();
   else TuneUp();
-  delay(50);
-
-  ShowFreq(0);
-  if (XDRGTKUSB || XDRGTKTCP) {
-    if (band == BAND_FM) DataPrint("M0\nT" + String(frequency * 10) + "\n");
-    else if (band == BAND_OIRT) DataPrint("M0\nT" + String(frequency_OIRT * 10) + "\n");
-    else DataPrint("M1\nT" + String(frequency_AM) + "\n");
-  }
+  seek = true;
+  seekstep = true;
 
   if (band < BAND_GAP) {
-    radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-    if ((USN < fmscansens * 30) && (WAM < 230) && (OStatus < 80 && OStatus > -80) && (!usesquelch || (Squelch < SStatus || Squelch == 920))) {
-      seek = false;
-      radio.setUnMute();
-      if (!screenmute) {
-        tft.drawBitmap(249, 4, Speaker, 28, 24, GreyoutColor);
-      }
-      store = true;
-    } else {
-      seek = true;
-      if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
-      if (RDSSPYTCP) RemoteClient.print("G:\r\nRESET-------\r\n\r\n");
+    if (millis() - seekdrawtimer >= SEEK_DRAW_INTERVAL) {
+      ShowSeekFreq();
+      seekdrawtimer = millis();
     }
   } else {
-    radio.getStatusAM(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-    if ((USN < amscansens * 30) && (OStatus < 2 && OStatus > -2) && (!usesquelch || (Squelch < SStatus || Squelch == 920))) {
-      seek = false;
-      radio.setUnMute();
-      if (!screenmute) {
-        tft.drawBitmap(249, 4, Speaker, 28, 24, GreyoutColor);
-      }
-      store = true;
-    } else {
-      seek = true;
-    }
+    ShowFreq(0);
+    if (XDRGTKUSB || XDRGTKTCP) DataPrint("M1\nT" + String(frequency_AM) + "\n");
   }
 }
 
@@ -4716,6 +4764,10 @@ void DefaultSettings() {
   EEPROM.writeByte(EE_BYTE_AUTODST, 1);
   EEPROM.writeByte(EE_BYTE_CLOCKAMPM, 0);
   EEPROM.writeUInt(EE_UINT16_PICTLOCK, 0);
+  EEPROM.writeByte(EE_BYTE_SEEKLEVELFM, 10);
+  EEPROM.writeByte(EE_BYTE_SEEKLEVELAM, 0);
+  EEPROM.writeByte(EE_BYTE_SEEKSNRFM, -128);
+  EEPROM.writeByte(EE_BYTE_SEEKSNRAM, -128);
 
 #ifdef HAS_AIR_BAND
   EEPROM.writeUInt(EE_UINT16_FREQUENCY_AIR, 135350);
@@ -4831,6 +4883,7 @@ void deepSleep() {
   digitalWrite(STANDBYLED, LOW);
   MuteScreen(1);
   StoreFrequency();
+  if (BandMap_Dirty()) BandMap_Save();
   radio.power(1);
   esp_sleep_enable_ext0_wakeup(GPIO_NUM_34, LOW);
   esp_deep_sleep_start();
@@ -4888,6 +4941,14 @@ void cancelDXScan() {
   ShowTuneMode();
   ShowMemoryPos();
   if (XDRGTKUSB || XDRGTKTCP) DataPrint("J0\n");
+
+  ScanDwellEnd();
+  scanstats.end = millis();
+  unsigned long scanduration = scanstats.end - scanstats.start;
+  uint32_t scanchannels = 0;
+  for (byte i = 0; i < SCAN_OUTCOMES; i++) scanchannels += scanstats.channels[i];
+  log_d("DX scan: %u channels in %lu ms, %lu/min, %u dead, %u signal, %u RDS, %u PI, %u logged", scanchannels, scanduration, scanduration ? scanchannels * 60000UL / scanduration : 0,
+        scanstats.channels[SCAN_DEAD], scanstats.channels[SCAN_SIGNAL], scanstats.channels[SCAN_RDS], scanstats.channels[SCAN_PI], scanstats.channels[SCAN_LOGGED]);
 }
 
 void endMenu() {
@@ -4958,6 +5019,10 @@ void endMenu() {
   EEPROM.writeByte(EE_BYTE_SPISPEED, spispeed);
   EEPROM.writeByte(EE_BYTE_AMSCANSENS, amscansens);
   EEPROM.writeByte(EE_BYTE_FMSCANSENS, fmscansens);
+  EEPROM.writeByte(EE_BYTE_SEEKLEVELFM, seeklevelfm);
+  EEPROM.writeByte(EE_BYTE_SEEKLEVELAM, seeklevelam);
+  EEPROM.writeByte(EE_BYTE_SEEKSNRFM, seeksnrfm);
+  EEPROM.writeByte(EE_BYTE_SEEKSNRAM, seeksnram);
   EEPROM.writeByte(EE_BYTE_FREQFONT, freqfont);
   EEPROM.writeByte(EE_BYTE_SKIN, CurrentSkin);
   EEPROM.writeByte(EE_BYTE_XDRGTKMUTE, XDRGTKMuteScreen);
@@ -5009,8 +5074,9 @@ void endMenu() {
 void startFMDXScan() {
   screensavertimer = millis();
   initdxscan = true;
-  scanholdflag = false;
   autologged = false;
+  memset(&scanstats, 0, sizeof(scanstats));
+  scanstats.start = millis();
   for (byte i = 0; i < 100; i++) {
     rabbitearspi[i] = 0;
     rabbitearstime[i][0] = 0;
@@ -5048,12 +5114,60 @@ void startFMDXScan() {
     SQ = true;
     Squelchold = -2;
   }
-  scantimer = millis();
+  ScanDwellStart();
   scandxmode = true;
   ShowTuneMode();
   if (XDRGTKUSB || XDRGTKTCP) DataPrint("J1\n");
 }
 
+void ScanDwellStart() {
+  scanholdflag = false;
+  scanrds = false;
+  scanpistate = RdsPiBuffer<>::STATE_INVALID;
+  scanloggedtimer = 0;
+  scantimer = millis();
+  scanprogresstimer = scantimer;
+}
+
+// Adaptive dwell of the DX scan, called once the channel has settled. When
+// holding on signal only, a dead channel is left after one quality read. A
+// live one is held for scanhold and longer while RDS syncs or the PI gets
+// more certain. Once PI and PS are in there is nothing left to wait for,
+// unless the logbook wants the RadioText too.
+bool ScanDwellDone() {
+  unsigned long hold = (scanhold == 0) ? 500 : (scanhold * 1000);
+  unsigned long now = millis();
+
+  ReadStatus(STATUS_MAXAGE);
+  if (!scanholdflag) scanholdflag = (USN < fmscansens * 30) && (WAM < 230) && (OStatus < 80) && (OStatus > -80);
+  if (!scanholdflag) return scanholdonsignal || now - scantimer >= hold;
+
+  if ((radio.rds.hasRDS && !scanrds) || radio.rds.piState < scanpistate) {
+    scanrds = scanrds || radio.rds.hasRDS;
+    scanpistate = radio.rds.piState;
+    scanprogresstimer = now;
+  }
+
+  if (!scanloggedtimer && radio.rds.hasRDS && radio.rds.correctPI != 0 && radio.ps_process) scanloggedtimer = now;
+  if (scanloggedtimer) return now - scantimer >= hold || (scanholdonsignal && scanhold < SCAN_DWELL_SHORT_HOLD && now - scanloggedtimer >= SCAN_DWELL_LOGGED);
+
+  if (now - scantimer < hold) return false;
+  return now - scanprogresstimer >= SCAN_DWELL_PROGRESS || now - scantimer >= hold + SCAN_DWELL_EXTEND;
+}
+
+void ScanDwellEnd() {
+  unsigned long dwell = millis() - scantimer;
+  byte outcome = SCAN_DEAD;
+
+  if (scanloggedtimer) outcome = SCAN_LOGGED;
+  else if (scanholdflag && radio.rds.correctPI != 0) outcome = SCAN_PI;
+  else if (scanholdflag && scanrds) outcome = SCAN_RDS;
+  else if (scanholdflag) outcome = SCAN_SIGNAL;
+
+  scanstats.channels[outcome]++;
+  scanstats.dwell[outcome] += dwell;
+}
+
 void rabbitearssend() {
   byte i = 0;
   bool hasreport = false;
@@ -5144,20 +5258,99 @@ void setAutoSpeedSPI() {
 #endif
 }
 
+static automem automemlist[AUTOMEM_CANDIDATES];
+static uint16_t automempi[AUTOMEM_PI_SLOTS];
+
+// PI of a 4 digit hex code as in rds.picode and presets[].RDSPI, 0 when there is none
+static uint16_t AutoMemPICode(const char *code) {
+  uint16_t pi = 0;
+
+  for (byte i = 0; i < 4; i++) {
+    char c = code[i];
+    if (c >= '0' && c <= '9') pi = (pi << 4) | (c - '0');
+    else if (c >= 'A' && c <= 'F') pi = (pi << 4) | (c - 'A' + 10);
+    else return 0;
+  }
+  return pi;
+}
+
+// Open addressed PI set, returns false when pi was already in it
+static bool AutoMemAddPI(uint16_t pi) {
+  uint16_t slot = (pi ^ (pi >> 8)) & (AUTOMEM_PI_SLOTS - 1);
+
+  while (automempi[slot] != 0) {
+    if (automempi[slot] == pi) return false;
+    slot = (slot + 1) & (AUTOMEM_PI_SLOTS - 1);
+  }
+  automempi[slot] = pi;
+  return true;
+}
+
+static bool AutoMemHasPI(uint16_t pi) {
+  uint16_t slot = (pi ^ (pi >> 8)) & (AUTOMEM_PI_SLOTS - 1);
+
+  while (automempi[slot] != 0) {
+    if (automempi[slot] == pi) return true;
+    slot = (slot + 1) & (AUTOMEM_PI_SLOTS - 1);
+  }
+  return false;
+}
+
+static void AutoMemProgress(uint8_t percent, uint8_t counter) {
+  switch (CurrentTheme) {
+    case 7:
+      SignalSprite.pushImage(-107, -95, 292, 170, popupbackground_wo);
+      SquelchSprite.pushImage(-177, -135, 292, 170, popupbackground_wo);
+      break;
+
+    default:
+      SignalSprite.pushImage(-107, -95, 292, 170, popupbackground);
+      SquelchSprite.pushImage(-177, -135, 292, 170, popupbackground);
+      break;
+  }
+
+  SignalSprite.setTextColor(SecondaryColor, SecondaryColorSmooth, false);
+  SignalSprite.setTextDatum(TC_DATUM);
+  SignalSprite.loadFont(FONT28);
+  SignalSprite.drawString(String(percent) + "%", 40, 0);
+  SignalSprite.unloadFont();
+  SignalSprite.pushSprite(120, 125);
+
+  if (language == LANGUAGE_CHS) SquelchSprite.loadFont(FONT16_CHS);
+  else SquelchSprite.loadFont(FONT16);
+  SquelchSprite.setTextColor(PrimaryColor, PrimaryColorSmooth, false);
+  SquelchSprite.drawString(String(counter), 0, 0);
+  SquelchSprite.pushSprite(200, 155);
+
+  tft.fillRect(60, 110, 2 * percent, 6, BarInsignificantColor);
+}
+
+static bool AutoMemAbort() {
+  if (digitalRead(MODEBUTTON) == LOW) {
+    while (digitalRead(MODEBUTTON)) delay(50);
+    return true;
+  }
+  return false;
+}
+
+// Two passes: a quick quality scan in search mode ranks every channel that
+// passes the seek test, then RDS is only collected on those candidates,
+// strongest first, until the memory range is full. The stations found are
+// stored in frequency order.
 uint8_t doAutoMemory(uint16_t startfreq, uint16_t stopfreq, uint8_t startmem, uint8_t stopmem, bool rdsonly, uint8_t doublepi) {
   uint8_t error = 0;
   uint8_t counter = 0;
-  uint8_t rangestart = startmem;
   uint16_t _current = frequency;
   uint16_t totalIterations = (stopfreq - startfreq) + 1;
   uint16_t currentIteration = 0;
+  uint16_t candidates = 0;
+  uint16_t slots = stopmem - startmem + 1;
   uint8_t percent = 0;
   uint8_t percentold = 0;
-  bool stopScanning = false;
-  bool dostore = false;
 
   radio.setMute();
   radio.power(0);
+  radio.setRDSHandlers(RDS_HANDLERS_LEAN);                                // PI and PS are all that is stored
   band = BAND_FM;
   tunemode = TUNE_MAN;
 
@@ -5165,94 +5358,97 @@ uint8_t doAutoMemory(uint16_t startfreq, uint16_t stopfreq, uint8_t startmem, ui
   tft.fillRect(60, 110, 200, 6, GreyoutColor);
   tftPrint(ARIGHT, textUI(272), 120, 155, ActiveColor, ActiveColorSmooth, 16);
 
-  for (frequency = startfreq * 10; frequency <= stopfreq * 10; frequency += 10) {
-    if (stopScanning) {
-      break;
-    }
-
+  // First pass, quality only
+  for (frequency = startfreq * 10; frequency <= stopfreq * 10 && !error; frequency += 10) {
     currentIteration++;
-    percent = (currentIteration * 100) / totalIterations;
+    percent = (currentIteration * 50) / totalIterations;
 
-    radio.SetFreq(frequency);
-    radio.clearRDS(fullsearchrds);
-    delay(50);
-    radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
+    radio.startTune(frequency, 2);
+    radio.waitTune();
+    ReadStatus(STATUS_MAXAGE);
     if ((USN < fmscansens * 30) && (WAM < 230) && (OStatus < 80 && OStatus > -80)) {
-      for (byte y = 0; y < 20; y++) {
-        delay(50);
-        radio.readRDS(showrdserrors);
-      }
-
-      dostore = true;
-      if (doublepi != 0) {
-        for (byte x = (doublepi == 1 ? rangestart : 0); x <= (doublepi == 1 ? stopmem : EE_PRESETS_CNT - 1); x++) {
-          if (presets[x].RDSPI[0] != '\0') {
-            bool allMatch = true;
+      int16_t score = SStatus - USN - WAM;
+      uint16_t x = candidates;
 
-            for (byte i = 0; i < 4; i++) {
-              if (presets[x].RDSPI[i] != radio.rds.picode[i]) {
-                allMatch = false;
-                break;
-              }
-            }
-
-            if (allMatch) {
-              dostore = false;
-              break;
-            }
-          }
-        }
+      if (candidates == AUTOMEM_CANDIDATES) {                             // Full, replace the weakest if this one is better
+        x = 0;
+        for (uint16_t i = 1; i < candidates; i++) if (automemlist[i].score < automemlist[x].score) x = i;
+        if (automemlist[x].score >= score) x = AUTOMEM_CANDIDATES;
+      } else {
+        candidates++;
       }
 
-      if (((rdsonly && radio.rds.hasRDS) || !rdsonly) && dostore) {
-        StoreMemoryPos(startmem);
-        counter++;
-        startmem++;
-        if (startmem > stopmem) {
-          error = 1;
-          stopScanning = true;
-          break;
-        }
-        dostore = false;
+      if (x < AUTOMEM_CANDIDATES) {
+        automemlist[x].frequency = frequency;
+        automemlist[x].score = score;
       }
     }
 
     if (percent != percentold) {
-      switch (CurrentTheme) {
-        case 7:
-          SignalSprite.pushImage(-107, -95, 292, 170, popupbackground_wo);
-          SquelchSprite.pushImage(-177, -135, 292, 170, popupbackground_wo);
-          break;
+      AutoMemProgress(percent, counter);
+      percentold = percent;
+    }
+    if (AutoMemAbort()) error = 2;
+  }
 
-        default:
-          SignalSprite.pushImage(-107, -95, 292, 170, popupbackground);
-          SquelchSprite.pushImage(-177, -135, 292, 170, popupbackground);
-          break;
-      }
+  for (uint16_t i = 1; i < candidates; i++) {                             // Strongest first
+    automem c = automemlist[i];
+    uint16_t j = i;
+    for (; j > 0 && automemlist[j - 1].score < c.score; j--) automemlist[j] = automemlist[j - 1];
+    automemlist[j] = c;
+  }
 
-      SignalSprite.setTextColor(SecondaryColor, SecondaryColorSmooth, false);
-      SignalSprite.setTextDatum(TC_DATUM);
-      SignalSprite.loadFont(FONT28);
-      SignalSprite.drawString(String(percent) + "%", 40, 0);
-      SignalSprite.unloadFont();
-      SignalSprite.pushSprite(120, 125);
+  memset(automempi, 0, sizeof(automempi));
+  if (doublepi != MEMPI_OFF) {
+    for (byte x = (doublepi == MEMPI_RANGE ? startmem : 0); x <= (doublepi == MEMPI_RANGE ? stopmem : EE_PRESETS_CNT - 1); x++) {
+      uint16_t pi = AutoMemPICode(presets[x].RDSPI);
+      if (pi) AutoMemAddPI(pi);
+    }
+  }
 
-      if (language == LANGUAGE_CHS) SquelchSprite.loadFont(FONT16_CHS);
-      else SquelchSprite.loadFont(FONT16);
-      SquelchSprite.setTextColor(PrimaryColor, PrimaryColorSmooth, false);
-      SquelchSprite.drawString(String(counter), 0, 0);
-      SquelchSprite.pushSprite(200, 155);
+  // Second pass, RDS on the candidates only
+  for (uint16_t i = 0; i < candidates && !error; i++) {
+    automem &c = automemlist[i];
 
-      tft.fillRect(60, 110, 2 * percent, 6, BarInsignificantColor);
+    radio.SetFreq(c.frequency);
+    radio.clearRDS(fullsearchrds);
+    radio.waitTune();
+    radio.watchRDS(RDS_SYNC_TIMEOUT);
+    radio.waitTune();
 
-      percentold = percent;
+    unsigned long rdsstart = millis();
+    while (radio.tune.rds && millis() - rdsstart < AUTOMEM_RDS_TIMEOUT) { // No sync, no RDS to collect
+      delay(AUTOMEM_RDS_POLL);
+      radio.readRDS(showrdserrors);
+      if (radio.rds.piState == RdsPiBuffer<>::STATE_CORRECT && (radio.ps_process || (doublepi != MEMPI_OFF && AutoMemHasPI(AutoMemPICode(radio.rds.picode))))) break;
     }
-    if (digitalRead(MODEBUTTON) == LOW) {
-      while (digitalRead(MODEBUTTON)) delay(50);
-      error = 2;
-      stopScanning = true;
-      break;
+
+    uint16_t pi = AutoMemPICode(radio.rds.picode);
+    if ((!rdsonly || radio.rds.hasRDS) && (doublepi == MEMPI_OFF || pi == 0 || AutoMemAddPI(pi))) {
+      memcpy(c.RDSPI, radio.rds.picode, sizeof(c.RDSPI));
+      strlcpy(c.RDSPS, radio.rds.stationName.c_str(), sizeof(c.RDSPS));
+      automemlist[counter++] = c;                                         // Keepers move to the front, counter <= i
+      if (counter == slots) error = 1;
     }
+
+    percent = 50 + ((i + 1) * 50) / candidates;
+    if (percent != percentold) {
+      AutoMemProgress(percent, counter);
+      percentold = percent;
+    }
+    if (!error && AutoMemAbort()) error = 2;
+  }
+
+  for (uint8_t i = 1; i < counter; i++) {
+    automem c = automemlist[i];
+    uint8_t j = i;
+    for (; j > 0 && automemlist[j - 1].frequency > c.frequency; j--) automemlist[j] = automemlist[j - 1];
+    automemlist[j] = c;
+  }
+
+  for (uint8_t i = 0; i < counter; i++) {
+    frequency = automemlist[i].frequency;
+    StoreMemoryPos(startmem + i, automemlist[i].RDSPS, automemlist[i].RDSPI);
   }
 
   frequency = _current;
@@ -5264,6 +5460,85 @@ uint8_t doAutoMemory(uint16_t startfreq, uint16_t stopfreq, uint8_t startmem, ui
   return error;
 }
 
+static bool HuntAbort() {
+  return rotary != 0 || digitalRead(BANDBUTTON) == LOW || digitalRead(MODEBUTTON) == LOW || digitalRead(BWBUTTON) == LOW || digitalRead(ROTARY_BUTTON) == LOW;
+}
+
+// Tunes freq and waits up to AF_CHECK_RDSWAIT for block A to carry pi
+static bool HuntCheckPI(uint16_t freq, uint16_t pi) {
+  radio.SetFreq(freq);
+  radio.waitTune();
+  radio.watchRDS(AF_CHECK_RDSWAIT);
+  while (!radio.tuneDone()) {
+    if (!screenmute && !advancedRDS) ShowModLevel();
+  }
+  return radio.tune.rds && radio.rds.rdsA == pi;
+}
+
+// Looks for pi on FM when a memory channel has faded. Frequencies known to
+// carry pi come first: presets, the band map and the logbook. They are
+// checked for pi whatever their quality. Then every other channel gets a
+// quick search tune for its quality, and only the ones that pass the seek
+// test are checked for pi, strongest first. The faded channel skip is left
+// out. The AF list is not used: the only caller hunts when the station
+// has none. Returns the frequency pi was found on, 0 otherwise.
+uint16_t HuntPI(uint16_t pi, uint16_t skip) {
+  uint32_t checked[(AF_CHANNELS + 31) / 32] = {0};
+  uint16_t known[PIHUNT_KNOWN];
+  uint8_t knowncount = 0;
+  uint16_t found = 0;
+  uint16_t checks = 0;
+  unsigned long start = millis();
+
+  if (skip >= 8750 && skip <= 10800) bitSet(checked[AF_CHANNEL(skip) / 32], AF_CHANNEL(skip) % 32);
+  for (byte x = 0; x < EE_PRESETS_CNT && knowncount < PIHUNT_KNOWN; x++) {
+    if (presets[x].band == BAND_FM && AutoMemPICode(presets[x].RDSPI) == pi) known[knowncount++] = presets[x].frequency;
+  }
+  for (int16_t slot = 0; slot < BANDMAP_FM_SLOTS && knowncount < PIHUNT_KNOWN; slot++) {
+    if (BandMap_Entry(slot)->pi == pi) known[knowncount++] = BandMap_Frequency(slot);
+  }
+  knowncount += findLogbookPI(pi, known + knowncount, PIHUNT_KNOWN - knowncount);
+
+  for (uint8_t i = 0; i < knowncount && !found; i++) {
+    uint16_t freq = known[i];
+    if (freq < 8750 || freq > 10800 || freq % 10 || bitRead(checked[AF_CHANNEL(freq) / 32], AF_CHANNEL(freq) % 32)) continue;
+    bitSet(checked[AF_CHANNEL(freq) / 32], AF_CHANNEL(freq) % 32);
+    if (HuntAbort()) break;
+    checks++;
+    if (HuntCheckPI(freq, pi)) found = freq;
+  }
+
+  if (!found && !HuntAbort()) {
+    uint16_t candidate[AF_CHANNELS];
+    int16_t score[AF_CHANNELS];
+    uint8_t candidates = 0;
+
+    for (uint16_t freq = 8750; freq <= 10800 && !HuntAbort(); freq += 10) {
+      if (bitRead(checked[AF_CHANNEL(freq) / 32], AF_CHANNEL(freq) % 32)) continue;
+      radio.startTune(freq, 2);
+      radio.waitTune();
+      ReadStatus(STATUS_MAXAGE);
+      if (!((USN < fmscansens * 30) && (WAM < 230) && (OStatus < 80 && OStatus > -80))) continue;
+
+      uint8_t j = candidates++;                                           // Strongest first
+      for (; j > 0 && score[j - 1] < SStatus - USN - WAM; j--) {
+        candidate[j] = candidate[j - 1];
+        score[j] = score[j - 1];
+      }
+      candidate[j] = freq;
+      score[j] = SStatus - USN - WAM;
+    }
+
+    for (uint8_t i = 0; i < candidates && !found && !HuntAbort(); i++) {
+      checks++;
+      if (HuntCheckPI(candidate[i], pi)) found = candidate[i];
+    }
+  }
+
+  log_d("PI hunt %04X: %s %u after %lu ms, %u known, %u checked", pi, found ? "found on" : "not found", found, millis() - start, knowncount, checks);
+  return found;
+}
+
 void doBandToggle() {
   if (tunemode != TUNE_MEM) {
     ToggleBand(band);
@@ -5284,6 +5559,16 @@ void doBandToggle() {
 }
 
 void StoreMemoryPos(uint8_t _pos) {
+  String stationName = radio.rds.stationName.c_str();
+  char stationNameCharArray[10];
+  char picodeArray[7];
+  stationName.toCharArray(stationNameCharArray, sizeof(stationNameCharArray));
+  memcpy(picodeArray, radio.rds.picode, sizeof(picodeArray));
+  StoreMemoryPos(_pos, stationNameCharArray, picodeArray);
+}
+
+// ps holds up to 9 characters, pi the 7 bytes of rds.picode
+void StoreMemoryPos(uint8_t _pos, const char *ps, const char *pi) {
   EEPROM.writeByte(_pos + EE_PRESETS_BAND_START, band);
   EEPROM.writeByte(_pos + EE_PRESET_BW_START, BWset);
   EEPROM.writeByte(_pos + EE_PRESET_MS_START, StereoToggle);
@@ -5303,19 +5588,13 @@ void StoreMemoryPos(uint8_t _pos) {
   presets[_pos].bw = BWset;
   presets[_pos].ms = StereoToggle;
 
-  String stationName = radio.rds.stationName;
-  char stationNameCharArray[10];
-  char picodeArray[7];
-  stationName.toCharArray(stationNameCharArray, sizeof(stationNameCharArray));
-  memcpy(picodeArray, radio.rds.picode, sizeof(picodeArray));
-
   for (int y = 0; y < 9; y++) {
-    presets[_pos].RDSPS[y] = (y < strlen(stationNameCharArray)) ? stationNameCharArray[y] : '\0';
+    presets[_pos].RDSPS[y] = (y < strlen(ps)) ? ps[y] : '\0';
     EEPROM.writeByte((_pos * 9) + y + EE_PRESETS_RDSPS_START, presets[_pos].RDSPS[y]);
   }
 
   for (int y = 0; y < 5; y++) {
-    presets[_pos].RDSPI[y] = (y < sizeof(picodeArray)) ? picodeArray[y] : '\0';
+    presets[_pos].RDSPI[y] = pi[y];
     EEPROM.writeByte((_pos * 5) + y + EE_PRESETS_RDSPI_START, presets[_pos].RDSPI[y]);
   }
 
@@ -5370,10 +5649,12 @@ int GetNum(void) {
   int cnt = 0;
   unsigned int num;
 
+  TunerTask_Lock();                                                       // Shares the I2C bus with the tuner task
   Wire.beginTransmission(0x20);
   Wire.write(0x00);
   Wire.endTransmission();
   Wire.requestFrom(0x20, 2);
+  TunerTask_Unlock();
 
   if (Wire.available() == 2) {
     keypadtimer = millis();
@@ -5553,6 +5834,41 @@ void toggleiMSEQ() {
   }
 }
 
+// Background band occupancy: every BANDMAP_INTERVAL the tuned channel is
+// recorded and, on FM, the next channel of the band gets an AF update
+// sample. The map goes to flash at most every BANDMAP_SAVE_INTERVAL.
+void BandMapService() {
+  quality_ sample;
+  uint8_t state = radio.pollSample(sample);
+
+  if (state == TUNE_SETTLING) return;
+  if (state == TUNE_READY && sample.offset >= -125 && sample.offset <= 125) {
+    BandMap_Update(bandmapfreq, false, sample.level, sample.usn, sample.wam, sample.usn < fmscansens * 30 && sample.wam < 230, rtc.getEpoch());
+  }
+
+  if (millis() - bandmaptimer < BANDMAP_INTERVAL) return;
+  bandmaptimer = millis();
+
+  if (band == BAND_FM) {
+    const quality_ &status = radio.getStatusIfOlderThan(STATUS_MAXAGE);
+    if (status.valid && !bitRead(status.status, 15)) {                    // Bit 15: still the data of an AF update
+      BandMap_Update(frequency, false, status.level, status.usn, status.wam, status.usn < fmscansens * 30 && status.wam < 230, rtc.getEpoch());
+    }
+    if (RDSstatus && radio.rds.correctPI != 0 && radio.ps_process) BandMap_SetRDS(frequency, radio.rds.correctPI, radio.rds.stationName.c_str());
+
+    bandmapfreq = BandMap_NextFM(bandmapfreq);
+    if (bandmapfreq == frequency) bandmapfreq = BandMap_NextFM(bandmapfreq);
+    radio.startSample(bandmapfreq);
+  } else if (band == BAND_LW || band == BAND_MW) {
+    BandMap_Update(frequency_AM, true, SStatus, USN, WAM, USN < amscansens * 30 && OStatus < 2 && OStatus > -2, rtc.getEpoch());
+  }
+
+  if (BandMap_Dirty() && millis() - bandmapsavetimer >= BANDMAP_SAVE_INTERVAL) {
+    BandMap_Save();
+    bandmapsavetimer = millis();
+  }
+}
+
 void doLog() {
   if (!autologged && RDSstatus && radio.rds.correctPI != 0) {
     if (autolog) {
@@ -0,0 +1,127 @@
+#include "BandMap.h"
+#include <Arduino.h>
+#include "SPIFFS.h"
+
+static bandmapentry_ bandmap[BANDMAP_SLOTS];
+static bool bandmapdirty = false;
+
+static int16_t BandMap_Score(const bandmapentry_ &entry) {
+  return entry.level - entry.usn - entry.wam;
+}
+
+void BandMap_Clear() {
+  memset(bandmap, 0, sizeof(bandmap));
+  for (uint16_t i = 0; i < BANDMAP_SLOTS; i++) bandmap[i].bestlevel = BANDMAP_NOLEVEL;
+  bandmapdirty = true;
+}
+
+bool BandMap_Load() {
+  bandmapheader_ header;
+
+  BandMap_Clear();
+  bandmapdirty = false;
+  fs::File file = SPIFFS.open(BANDMAP_FILE, "r");
+  if (!file) return false;
+  if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || header.magic != BANDMAP_MAGIC || header.version != BANDMAP_VERSION || header.entrysize != sizeof(bandmapentry_) || header.slots != BANDMAP_SLOTS ||
+      file.read((uint8_t *)bandmap, sizeof(bandmap)) != sizeof(bandmap)) {
+    file.close();
+    BandMap_Clear();                                                      // Stale layout, start over
+    bandmapdirty = false;
+    return false;
+  }
+  file.close();
+  return true;
+}
+
+bool BandMap_Save() {
+  bandmapheader_ header = {BANDMAP_MAGIC, BANDMAP_VERSION, sizeof(bandmapentry_), BANDMAP_SLOTS};
+
+  fs::File file = SPIFFS.open(BANDMAP_FILE, "w");
+  if (!file) return false;
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) && file.write((const uint8_t *)bandmap, sizeof(bandmap)) == sizeof(bandmap);
+  file.close();
+  if (ok) bandmapdirty = false;
+  return ok;
+}
+
+bool BandMap_Dirty() {
+  return bandmapdirty;
+}
+
+// Slot of a channel, -1 when it is not on one of the grids
+int16_t BandMap_Slot(uint16_t frequency, bool am) {
+  if (!am) {
+    if (frequency < BANDMAP_FM_FIRST || (frequency - BANDMAP_FM_FIRST) % BANDMAP_FM_STEP) return -1;
+    uint16_t slot = (frequency - BANDMAP_FM_FIRST) / BANDMAP_FM_STEP;
+    return slot < BANDMAP_FM_SLOTS ? slot : -1;
+  }
+
+  if (frequency >= BANDMAP_LW_FIRST && frequency < BANDMAP_LW_FIRST + BANDMAP_LW_SLOTS * BANDMAP_AM_STEP) {
+    if ((frequency - BANDMAP_LW_FIRST) % BANDMAP_AM_STEP) return -1;
+    return BANDMAP_FM_SLOTS + (frequency - BANDMAP_LW_FIRST) / BANDMAP_AM_STEP;
+  }
+  if (frequency >= BANDMAP_MW_FIRST && frequency < BANDMAP_MW_FIRST + BANDMAP_MW_SLOTS * BANDMAP_AM_STEP) {
+    if ((frequency - BANDMAP_MW_FIRST) % BANDMAP_AM_STEP) return -1;
+    return BANDMAP_FM_SLOTS + BANDMAP_LW_SLOTS + (frequency - BANDMAP_MW_FIRST) / BANDMAP_AM_STEP;
+  }
+  return -1;
+}
+
+uint16_t BandMap_Frequency(int16_t slot) {
+  if (slot < BANDMAP_FM_SLOTS) return BANDMAP_FM_FIRST + slot * BANDMAP_FM_STEP;
+  slot -= BANDMAP_FM_SLOTS;
+  if (slot < BANDMAP_LW_SLOTS) return BANDMAP_LW_FIRST + slot * BANDMAP_AM_STEP;
+  return BANDMAP_MW_FIRST + (slot - BANDMAP_LW_SLOTS) * BANDMAP_AM_STEP;
+}
+
+const bandmapentry_ *BandMap_Entry(int16_t slot) {
+  return (slot >= 0 && slot < BANDMAP_SLOTS) ? &bandmap[slot] : nullptr;
+}
+
+void BandMap_Update(uint16_t frequency, bool am, int16_t level, uint16_t usn, uint16_t wam, bool occupied, uint32_t now) {
+  int16_t slot = BandMap_Slot(frequency, am);
+  if (slot < 0) return;
+
+  bandmapentry_ &entry = bandmap[slot];
+  entry.level = level;
+  entry.usn = usn;
+  entry.wam = wam;
+  if (level > entry.bestlevel) entry.bestlevel = level;
+  if (occupied) entry.lastseen = now ? now : 1;
+  bandmapdirty = true;
+}
+
+void BandMap_SetRDS(uint16_t frequency, uint16_t pi, const char *ps) {
+  int16_t slot = BandMap_Slot(frequency, false);
+  if (slot < 0) return;
+
+  bandmapentry_ &entry = bandmap[slot];
+  if (entry.pi == pi && strncmp(entry.ps, ps, sizeof(entry.ps)) == 0) return;
+  entry.pi = pi;
+  strncpy(entry.ps, ps, sizeof(entry.ps));
+  bandmapdirty = true;
+}
+
+// FM channel to sample after frequency, round robin over the band
+uint16_t BandMap_NextFM(uint16_t frequency) {
+  int16_t slot = BandMap_Slot(frequency, false);
+  return BandMap_Frequency(slot < 0 || slot + 1 >= BANDMAP_FM_SLOTS ? 0 : slot + 1);
+}
+
+// Slots of the channels ever found occupied on FM or AM, best last sample
+// first. Returns how many were put in slots.
+uint16_t BandMap_Rank(int16_t *slots, uint16_t max, bool am) {
+  uint16_t count = 0;
+
+  for (int16_t i = am ? BANDMAP_FM_SLOTS : 0; i < (am ? BANDMAP_SLOTS : BANDMAP_FM_SLOTS); i++) {
+    if (!bandmap[i].lastseen) continue;
+    int16_t score = BandMap_Score(bandmap[i]);
+    uint16_t j = count < max ? count++ : max;
+    while (j > 0 && BandMap_Score(bandmap[slots[j - 1]]) < score) {
+      if (j < max) slots[j] = slots[j - 1];
+      j--;
+    }
+    if (j < max) slots[j] = i;
+  }
+  return count;
+}
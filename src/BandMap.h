@@ -0,0 +1,56 @@
+#ifndef BAND_MAP_H
+#define BAND_MAP_H
+
+#include <stdint.h>
+
+#define BANDMAP_FILE                "/bandmap.bin"
+#define BANDMAP_MAGIC               0x50414D42                            // "BMAP"
+#define BANDMAP_VERSION             1
+#define BANDMAP_FM_FIRST            8750                                  // 10 kHz units
+#define BANDMAP_FM_STEP             10
+#define BANDMAP_FM_SLOTS            206                                   // 87.5 .. 108.0 MHz, as the AF channels
+#define BANDMAP_LW_FIRST            153                                   // kHz
+#define BANDMAP_LW_SLOTS            15                                    // 153 .. 279 kHz
+#define BANDMAP_MW_FIRST            531
+#define BANDMAP_MW_SLOTS            120                                   // 531 .. 1602 kHz
+#define BANDMAP_AM_STEP             9
+#define BANDMAP_SLOTS               (BANDMAP_FM_SLOTS + BANDMAP_LW_SLOTS + BANDMAP_MW_SLOTS)
+#define BANDMAP_INTERVAL            1000                                  // ms between background samples
+#define BANDMAP_SAVE_INTERVAL       600000                                // ms between flash writes of a changed map
+#define BANDMAP_NOLEVEL             -32768
+
+typedef struct __attribute__((packed)) _bandmapheader_ {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entrysize;                                                     // sizeof(bandmapentry_) when written
+  uint16_t slots;
+} bandmapheader_;
+
+typedef struct __attribute__((packed)) _bandmapentry_ {
+  int16_t bestlevel;                                                      // 0.1 dBuV, BANDMAP_NOLEVEL before the first sample
+  int16_t level;                                                          // Last sample
+  uint16_t usn;                                                           // Last sample, AM: noise
+  uint16_t wam;                                                           // Last sample, AM: co-channel
+  uint16_t pi;                                                            // 0 until decoded on the tuned channel
+  char ps[8];                                                             // Not terminated
+  uint32_t lastseen;                                                      // RTC epoch of the last occupied sample, 0 never
+} bandmapentry_;
+
+// Occupancy history per channel: 206 FM slots and the LW and MW 9 kHz
+// grids, kept in RAM and written to flash by BandMap_Save(). Quality
+// comes from background AF update samples on FM and from the tuned
+// channel on every band; PI and PS only from the tuned channel, as an
+// AF update is too short for RDS. Frequencies are in the units of the
+// band, 10 kHz on FM and kHz on AM. Off-grid channels are not kept.
+void BandMap_Clear();
+bool BandMap_Load();
+bool BandMap_Save();
+bool BandMap_Dirty();
+int16_t BandMap_Slot(uint16_t frequency, bool am);
+uint16_t BandMap_Frequency(int16_t slot);
+const bandmapentry_ *BandMap_Entry(int16_t slot);
+void BandMap_Update(uint16_t frequency, bool am, int16_t level, uint16_t usn, uint16_t wam, bool occupied, uint32_t now);
+void BandMap_SetRDS(uint16_t frequency, uint16_t pi, const char *ps);
+uint16_t BandMap_NextFM(uint16_t frequency);
+uint16_t BandMap_Rank(int16_t *slots, uint16_t max, bool am);
+#endif
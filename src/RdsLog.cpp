@@ -0,0 +1,144 @@
+#include "RdsLog.h"
+#include <Arduino.h>
+#include "SPIFFS.h"
+
+static fs::File logfile;
+static bool logrecording = false;
+static bool logreplaying = false;
+static rdslogrecord_ logcache[RDS_LOG_CACHE];
+static uint8_t logcached = 0;
+static uint32_t logrecords = 0;
+static uint32_t logbytes = 0;
+static uint32_t logstart = 0;                                             // Timestamp of the first record
+static uint16_t logspeed = 100;
+static rdslogrecord_ lognext;                                             // Replay: read but not yet due
+static bool logpending = false;
+static uint16_t logfrequency = 0;                                         // Replay: frequency of the last record handed over
+
+// Writes out the cache. On a limit the records are written up to the
+// limit and the rest are dropped.
+static bool RdsLog_Write() {
+  size_t bytes = logcached * sizeof(rdslogrecord_);
+  if (bytes == 0) return true;
+
+  size_t room = RDS_LOG_MAX_BYTES - logbytes;
+  size_t space = SPIFFS.totalBytes() - SPIFFS.usedBytes();
+  if (space < RDS_LOG_RESERVE) room = 0;
+  else if (space - RDS_LOG_RESERVE < room) room = space - RDS_LOG_RESERVE;
+  room -= room % sizeof(rdslogrecord_);
+  if (room > bytes) room = bytes;
+
+  logcached = 0;
+  logbytes += room;
+  return logfile.write((const uint8_t *)logcache, room) == room && room == bytes;
+}
+
+bool RdsLog_Start() {
+  rdslogheader_ header = {RDS_LOG_MAGIC, RDS_LOG_VERSION, sizeof(rdslogrecord_)};
+
+  RdsLog_StopReplay();
+  RdsLog_Stop();
+  logfile = SPIFFS.open(RDS_LOG_FILE, "w");
+  if (!logfile) return false;
+  if (logfile.write((const uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+    logfile.close();
+    return false;
+  }
+  logcached = 0;
+  logrecords = 0;
+  logbytes = sizeof(header);
+  logrecording = true;
+  return true;
+}
+
+void RdsLog_Stop() {
+  if (!logrecording) return;
+  RdsLog_Write();
+  logfile.close();
+  logrecording = false;
+}
+
+bool RdsLog_Recording() {
+  return logrecording;
+}
+
+void RdsLog_Record(const tunergroup_ &group, uint16_t frequency) {
+  if (!logrecording) return;
+  if (logrecords == 0) logstart = group.timestamp;
+
+  rdslogrecord_ &record = logcache[logcached++];
+  record.timestamp = group.timestamp - logstart;
+  record.frequency = frequency;
+  record.status = group.status;
+  record.blockA = group.blockA;
+  record.blockB = group.blockB;
+  record.blockC = group.blockC;
+  record.blockD = group.blockD;
+  record.error = group.error;
+  logrecords++;
+
+  if (logcached == RDS_LOG_CACHE && !RdsLog_Write()) RdsLog_Stop();      // Flash or size limit reached
+}
+
+uint32_t RdsLog_Records() {
+  return logrecords;
+}
+
+bool RdsLog_Replay(uint16_t speed) {
+  rdslogheader_ header;
+
+  RdsLog_Stop();
+  RdsLog_StopReplay();
+  logfile = SPIFFS.open(RDS_LOG_FILE, "r");
+  if (!logfile) return false;
+  if (logfile.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || header.magic != RDS_LOG_MAGIC || header.version != RDS_LOG_VERSION || header.recordsize != sizeof(rdslogrecord_)) {
+    logfile.close();
+    return false;
+  }
+  logspeed = speed;
+  logstart = millis();
+  logrecords = 0;
+  logpending = false;
+  logfrequency = 0;
+  logreplaying = true;
+  return true;
+}
+
+void RdsLog_StopReplay() {
+  if (!logreplaying) return;
+  logfile.close();
+  logreplaying = false;
+}
+
+bool RdsLog_Replaying() {
+  return logreplaying;
+}
+
+// Hands over the next record once it is due, ends the replay at the end of the file
+bool RdsLog_Next(tunergroup_ &group, bool &retuned) {
+  if (!logreplaying) return false;
+
+  if (!logpending) {
+    if (logfile.read((uint8_t *)&lognext, sizeof(lognext)) != sizeof(lognext)) {
+      RdsLog_StopReplay();
+      return false;
+    }
+    logpending = true;
+  }
+
+  if (logspeed && (uint64_t)lognext.timestamp * 100 / logspeed > millis() - logstart) return false;
+
+  group.timestamp = logstart + lognext.timestamp;
+  group.seq = 0;
+  group.status = lognext.status;
+  group.blockA = lognext.blockA;
+  group.blockB = lognext.blockB;
+  group.blockC = lognext.blockC;
+  group.blockD = lognext.blockD;
+  group.error = lognext.error;
+  retuned = lognext.frequency != logfrequency;
+  logfrequency = lognext.frequency;
+  logpending = false;
+  logrecords++;
+  return true;
+}
@@ -0,0 +1,48 @@
+#ifndef RDS_LOG_H
+#define RDS_LOG_H
+
+#include <stdint.h>
+#include "Tuner_RDS.h"
+
+#define RDS_LOG_FILE                "/rdslog.bin"
+#define RDS_LOG_MAGIC               0x4C534452                            // "RDSL"
+#define RDS_LOG_VERSION             1
+#define RDS_LOG_CACHE               32                                    // Records kept in RAM between flash writes, ~2.8 s
+#define RDS_LOG_MAX_BYTES           262144                                // ~20 minutes of RDS
+#define RDS_LOG_RESERVE             16384                                 // Flash left free for logbook and settings
+#define RDS_LOG_REPLAY_BURST        32                                    // Records handed to one readRDS() call at most
+
+typedef struct __attribute__((packed)) _rdslogheader_ {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordsize;                                                    // sizeof(rdslogrecord_) when written
+} rdslogheader_;
+
+typedef struct __attribute__((packed)) _rdslogrecord_ {
+  uint32_t timestamp;                                                     // ms since the first record
+  uint16_t frequency;                                                     // Tuned frequency, 10 kHz units
+  uint16_t status;
+  uint16_t blockA;
+  uint16_t blockB;
+  uint16_t blockC;
+  uint16_t blockD;
+  uint16_t error;
+} rdslogrecord_;
+
+// Binary capture of the RDS group stream as it leaves the tuner, for
+// replaying into TEF6686::readRDS(). The file is a header followed by
+// little endian records. Recording appends every group readRDS() takes
+// from the queue; replay feeds the decoder from the file instead of the
+// tuner. speed is in percent of real time, 0 replays as fast as
+// readRDS() is called. RdsLog_Next() sets retuned on the first record of
+// a replay and whenever the capture moves to another frequency.
+bool RdsLog_Start();
+void RdsLog_Stop();
+bool RdsLog_Recording();
+void RdsLog_Record(const tunergroup_ &group, uint16_t frequency);
+uint32_t RdsLog_Records();
+bool RdsLog_Replay(uint16_t speed);
+void RdsLog_StopReplay();
+bool RdsLog_Replaying();
+bool RdsLog_Next(tunergroup_ &group, bool &retuned);
+#endif
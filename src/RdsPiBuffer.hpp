@@ -3,6 +3,12 @@
 
 #include <stdint.h>
 
+/* Confidence of a PI code over the last WINDOW received groups. Every
+ * distinct PI in the window has a running count of total and error free
+ * occurrences, so add() and state() cost the same whatever the window
+ * size: the oldest group is taken off its count when it leaves the
+ * window and the new one is looked up through a small hash table. */
+template <uint8_t WINDOW = 64>
 class RdsPiBuffer
 {
 public:
@@ -15,19 +21,189 @@ public:
         STATE_INVALID     = 4
     };
 
-    RdsPiBuffer();
-    State add(uint16_t value, bool error);
-    void clear();
+    RdsPiBuffer()
+    {
+        this->clear();
+    }
+
+    State add(uint16_t value, bool error)
+    {
+        if (this->fill == WINDOW)
+        {
+            this->release(this->pos);
+        }
+        else
+        {
+            this->fill++;
+        }
+
+        uint8_t index = this->find(value);
+        if (index == NONE)
+        {
+            index = this->freeHead;
+            this->freeHead = this->entry[index].next;
+            this->entry[index].value = value;
+            this->entry[index].count = 0;
+            this->entry[index].correct = 0;
+            this->entry[index].next = this->head[hash(value)];
+            this->head[hash(value)] = index;
+        }
+
+        Entry &e = this->entry[index];
+        e.count++;
+        if (!error)
+        {
+            e.correct++;
+        }
+        this->slot[this->pos] = index;
+        this->setError(this->pos, error);
+        this->pos = (this->pos + 1) % WINDOW;
+
+        return getState(e.count, e.correct);
+    }
+
+    void clear()
+    {
+        this->fill = 0;
+        this->pos = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++)
+        {
+            this->head[i] = NONE;
+        }
+        for (uint8_t i = 0; i < WINDOW; i++)
+        {
+            this->entry[i].next = (i + 1 < WINDOW) ? i + 1 : NONE;
+        }
+        this->freeHead = 0;
+    }
+
+    /* Confidence of value without adding an occurrence */
+    State state(uint16_t value) const
+    {
+        const uint8_t index = this->find(value);
+        if (index == NONE)
+        {
+            return STATE_INVALID;
+        }
+        return getState(this->entry[index].count, this->entry[index].correct);
+    }
+
+    uint8_t count(uint16_t value) const
+    {
+        const uint8_t index = this->find(value);
+        return (index == NONE) ? 0 : this->entry[index].count;
+    }
+
+    uint8_t correct(uint16_t value) const
+    {
+        const uint8_t index = this->find(value);
+        return (index == NONE) ? 0 : this->entry[index].correct;
+    }
+
+    uint8_t size() const
+    {
+        return this->fill;
+    }
 
 private:
-    /* BUFF_SIZE must be a multiple of 8 */
-    static constexpr uint8_t BUFF_SIZE = 64;
-    uint16_t buff[BUFF_SIZE];
-    uint8_t errorBuff[BUFF_SIZE/8];
+    static_assert(WINDOW > 0 && WINDOW < 255, "WINDOW must fit an 8 bit index");
+    static constexpr uint8_t NONE = 0xFF;
+    static constexpr uint8_t BUCKETS = 16;
+
+    struct Entry
+    {
+        uint16_t value;
+        uint8_t count;
+        uint8_t correct;
+        uint8_t next;
+    };
+
+    Entry entry[WINDOW];
+    uint8_t slot[WINDOW];                                   /* Entry of each group in the window */
+    uint8_t errorBuff[(WINDOW + 7) / 8];
+    uint8_t head[BUCKETS];
+    uint8_t freeHead;
     uint8_t fill;
-    uint8_t pos;
+    uint8_t pos;                                            /* Next slot, the oldest one when full */
+
+    static uint8_t hash(uint16_t value)
+    {
+        return (value ^ (value >> 4) ^ (value >> 8) ^ (value >> 12)) & (BUCKETS - 1);
+    }
+
+    uint8_t find(uint16_t value) const
+    {
+        uint8_t index = this->head[hash(value)];
+        while (index != NONE && this->entry[index].value != value)
+        {
+            index = this->entry[index].next;
+        }
+        return index;
+    }
+
+    bool getError(uint8_t i) const
+    {
+        return this->errorBuff[i / 8] & (1 << (i % 8));
+    }
+
+    void setError(uint8_t i, bool error)
+    {
+        if (error)
+        {
+            this->errorBuff[i / 8] |= (1 << (i % 8));
+        }
+        else
+        {
+            this->errorBuff[i / 8] &= ~(1 << (i % 8));
+        }
+    }
+
+    /* Take the group in slot i out of its PI count, freeing the entry at zero */
+    void release(uint8_t i)
+    {
+        const uint8_t index = this->slot[i];
+        Entry &e = this->entry[index];
+        e.count--;
+        if (!this->getError(i))
+        {
+            e.correct--;
+        }
+        if (e.count)
+        {
+            return;
+        }
+
+        uint8_t *link = &this->head[hash(e.value)];
+        while (*link != index)
+        {
+            link = &this->entry[*link].next;
+        }
+        *link = e.next;
+        e.next = this->freeHead;
+        this->freeHead = index;
+    }
+
+    static State getState(uint8_t count, uint8_t correctCount)
+    {
+        if (correctCount >= 2)
+        {
+            return STATE_CORRECT;
+        }
+        else if (count >= 2 && correctCount)
+        {
+            return STATE_VERY_LIKELY;
+        }
+        else if (count >= 3)
+        {
+            return STATE_LIKELY;
+        }
+        else if (count == 2 || correctCount)
+        {
+            return STATE_UNLIKELY;
+        }
 
-    State getState(uint16_t value);
+        return STATE_INVALID;
+    }
 };
 
 #endif
@@ -0,0 +1,44 @@
+#ifndef RDS_TEXT_H
+#define RDS_TEXT_H
+
+#include <stdint.h>
+#include <string.h>
+
+/* Fixed capacity UTF-8 text for decoded RDS fields. SIZE is in bytes,
+ * excluding the terminator. seq changes whenever the content does, so a
+ * consumer only has to copy or redraw the text when it differs from the
+ * sequence it saw last time. */
+template <uint16_t SIZE>
+class RdsText
+{
+public:
+    RdsText() : len(0), seq(0) { text[0] = '\0'; }
+
+    bool set(const char *value, uint16_t length)
+    {
+        if (length > SIZE) length = SIZE;
+        if (length == len && memcmp(text, value, length) == 0) return false;
+        memmove(text, value, length);
+        text[length] = '\0';
+        len = length;
+        seq++;
+        return true;
+    }
+
+    bool set(const char *value) { return set(value, strlen(value)); }
+    void clear() { set("", 0); }
+    RdsText &operator=(const char *value) { set(value); return *this; }
+
+    const char *c_str() const { return text; }
+    operator const char *() const { return text; }
+    uint16_t length() const { return len; }
+    uint16_t sequence() const { return seq; }
+    static uint16_t capacity() { return SIZE; }
+
+private:
+    char text[SIZE + 1];
+    uint16_t len;
+    uint16_t seq;
+};
+
+#endif
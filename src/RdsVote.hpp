@@ -0,0 +1,92 @@
+#ifndef RDS_VOTE_H
+#define RDS_VOTE_H
+
+#include <stdint.h>
+
+/* Per character voting for PS and RadioText. Each position keeps a few
+ * candidate characters with a score. A sighting adds its weight to the
+ * matching candidate and takes the same amount off the others, so one
+ * corrupted segment cannot overwrite a character that was received
+ * cleanly before. The best candidate is kept in slot 0; ties go to the
+ * newest sighting, so error free data behaves as a plain overwrite. */
+template <uint8_t LENGTH>
+class RdsVote
+{
+public:
+    static constexpr uint8_t CANDIDATES = 3;
+    static constexpr uint8_t MAX_SCORE = 8;
+    static constexpr uint8_t LOCK = 8;                  /* Two error free sightings */
+
+    RdsVote() { clear(); }
+
+    void clear()
+    {
+        for (uint8_t i = 0; i < LENGTH; i++) {
+            for (uint8_t j = 0; j < CANDIDATES; j++) {
+                slot[i].value[j] = 0;
+                slot[i].score[j] = 0;
+            }
+        }
+    }
+
+    /* Weight of a character from the error level (0..3) of its blocks */
+    static uint8_t weight(uint8_t error)
+    {
+        static const uint8_t weights[4] = {4, 2, 1, 0};
+        return weights[error & 0x03];
+    }
+
+    /* Returns the character to show at pos after the vote */
+    uint8_t add(uint8_t pos, uint8_t value, uint8_t w)
+    {
+        if (pos >= LENGTH) return value;
+        Slot &s = slot[pos];
+        if (w == 0) return s.score[0] ? s.value[0] : value;
+
+        uint8_t i = 0;
+        while (i < CANDIDATES && !(s.score[i] && s.value[i] == value)) i++;
+        if (i == CANDIDATES) {
+            i = CANDIDATES - 1;                         /* Replace the weakest */
+            s.value[i] = value;
+            s.score[i] = 0;
+        }
+
+        for (uint8_t j = 0; j < CANDIDATES; j++) {
+            if (j != i) s.score[j] = s.score[j] > w ? s.score[j] - w : 0;
+        }
+        s.score[i] = s.score[i] + w > MAX_SCORE ? MAX_SCORE : s.score[i] + w;
+
+        while (i > 0 && s.score[i] >= s.score[i - 1]) {
+            uint8_t v = s.value[i];
+            uint8_t c = s.score[i];
+            s.value[i] = s.value[i - 1];
+            s.score[i] = s.score[i - 1];
+            s.value[i - 1] = v;
+            s.score[i - 1] = c;
+            i--;
+        }
+        return s.value[0];
+    }
+
+    uint8_t best(uint8_t pos) const { return slot[pos].value[0]; }
+    uint8_t confidence(uint8_t pos) const { return slot[pos].score[0]; }
+
+    /* All positions in [from, to) have a winner at LOCK or above */
+    bool locked(uint8_t from, uint8_t to) const
+    {
+        for (uint8_t i = from; i < to && i < LENGTH; i++) {
+            if (slot[i].score[0] < LOCK) return false;
+        }
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        uint8_t value[CANDIDATES];
+        uint8_t score[CANDIDATES];
+    };
+    Slot slot[LENGTH];
+};
+
+#endif
@@ -4,13 +4,23 @@
 #include "Arduino.h"
 #include "Tuner_Drv_Lithio.h"
 #include "Tuner_Interface.h"
+#include "Tuner_Task.h"
+#include "Tuner_RDS.h"
+#include "RdsLog.h"
 #include "RdsPiBuffer.hpp"
+#include "RdsText.hpp"
+#include "RdsVote.hpp"
 
 extern const unsigned char tuner_init_tab[] PROGMEM;
 extern const unsigned char tuner_init_tab9216[] PROGMEM;
 extern const unsigned char tuner_init_tab4000[] PROGMEM;
 extern const unsigned char tuner_init_tab12000[] PROGMEM;
 extern const unsigned char tuner_init_tab55000[] PROGMEM;
+extern const uint16_t tuner_init_tab_size;
+extern const uint16_t tuner_init_tab9216_size;
+extern const uint16_t tuner_init_tab4000_size;
+extern const uint16_t tuner_init_tab12000_size;
+extern const uint16_t tuner_init_tab55000_size;
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
@@ -22,6 +32,52 @@ enum RDS_GROUPS {
   RDS_GROUP_12A, RDS_GROUP_12B, RDS_GROUP_13A, RDS_GROUP_13B, RDS_GROUP_14A, RDS_GROUP_14B, RDS_GROUP_15A, RDS_GROUP_15B
 };
 
+#define RDS_GROUP_MASK(group)       (1UL << (group))
+
+enum RDS_HANDLERS {
+  RDS_HANDLER_PS,     RDS_HANDLER_AF,     RDS_HANDLER_SLC,    RDS_HANDLER_RT,     RDS_HANDLER_RT32,   RDS_HANDLER_ODA,    RDS_HANDLER_CT,
+  RDS_HANDLER_PTYN,   RDS_HANDLER_RTPLUS, RDS_HANDLER_ERT,    RDS_HANDLER_TMC,    RDS_HANDLER_DABAF,  RDS_HANDLER_EON,    RDS_HANDLER_LONGPS,
+  RDS_HANDLER_COUNT
+};
+
+#define RDS_HANDLERS_ALL            ((1UL << RDS_HANDLER_COUNT) - 1)
+#define RDS_HANDLERS_LEAN           (RDS_HANDLERS_ALL & ~((1UL << RDS_HANDLER_RTPLUS) | (1UL << RDS_HANDLER_ERT) | (1UL << RDS_HANDLER_DABAF) | (1UL << RDS_HANDLER_EON) | (1UL << RDS_HANDLER_LONGPS) | (1UL << RDS_HANDLER_PTYN))) // Screen off or DX scan
+
+enum TEF_SHADOW {
+  SHADOW_FM_BANDWIDTH, SHADOW_AM_BANDWIDTH, SHADOW_FM_AGC,        SHADOW_AM_AGC,        SHADOW_FM_OFFSET,    SHADOW_AM_OFFSET,
+  SHADOW_AM_COCHANNEL, SHADOW_FM_SOFTMUTE,  SHADOW_AM_SOFTMUTE,   SHADOW_FM_NB,         SHADOW_AM_NB,        SHADOW_AM_ATTENUATION,
+  SHADOW_IMS,          SHADOW_EQ,           SHADOW_MONO,          SHADOW_DEEMPHASIS,    SHADOW_FMSI,         SHADOW_FMSI_TIME,
+  SHADOW_FMSI_GAIN,    SHADOW_FMSI_BIAS,    SHADOW_STEREOLEVEL,   SHADOW_HIGHCUTOFFSET, SHADOW_HIGHCUTLEVEL, SHADOW_STHIBLENDLEVEL,
+  SHADOW_STHIBLENDOFFSET, SHADOW_EXTENDBW,  SHADOW_COUNT
+};
+
+#define DSP_KEEP                    -1                                    // Profile field left as is
+
+// Named DSP settings, applied with TEF6686::applyProfile(). Only the fields
+// that differ from what the tuner already runs are sent. The profiles
+// themselves are listed in TEF6686.cpp.
+typedef struct _dspprofile_ {
+  const char *name;
+  int16_t agc;
+  int16_t bandwidth;                                                      // kHz, 0 = adaptive
+  int16_t deemphasis;
+  int16_t stereolevel;
+  int16_t highcutlevel;
+  int16_t highcutoffset;
+  int16_t sthiblendlevel;
+  int16_t sthiblendoffset;
+  int16_t fmnb;
+  int16_t softmutefm;
+  int16_t ims;
+  int16_t eq;
+  int16_t amagc;
+  int16_t ambandwidth;
+  int16_t amnb;
+  int16_t amcochannel;
+  int16_t amattenuation;
+  int16_t softmuteam;
+} dspprofile_;
+
 // Fixed PI/callsign combinations for Canada
 static const uint16_t fixedPI[] = {0x4C10, 0x4C11, 0x4C12};
 static const char* fixedCalls[] = {"CBLA", "CBFM", "CBOT"};
@@ -569,126 +625,278 @@ const DABFrequencyLabel DABfrequencyTable[] = {
 
 #pragma GCC diagnostic pop
 
-typedef struct _rds_ {
-  byte region;
+#define RDS_UTF8_MAX                3                                     // UTF-8 bytes per character of the RDS character set
+#define RDS_PI_WINDOW               64                                    // Groups the PI confidence is taken over
+
+typedef struct _rdschar_ {
+  uint8_t length;                                                         // 0: not a printable RDS character
+  char utf8[RDS_UTF8_MAX + 1];
+} rdschar_;
+
+// RDS basic character set (IEC 62106 annex E, table E.1) pre-encoded as UTF-8
+static constexpr rdschar_ RDScharset[256] = {
+  {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""},  // 0x00
+  {0, ""}, {0, ""}, {1, " "}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""},  // 0x08
+  {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""},  // 0x10
+  {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""}, {0, ""},  // 0x18
+  {1, " "}, {1, "!"}, {1, "\x22"}, {1, "#"}, {1, "$"}, {1, "%"}, {1, "&"}, {1, "'"},  // 0x20
+  {1, "("}, {1, ")"}, {1, "*"}, {1, "+"}, {1, ","}, {1, "-"}, {1, "."}, {1, "/"},  // 0x28
+  {1, "0"}, {1, "1"}, {1, "2"}, {1, "3"}, {1, "4"}, {1, "5"}, {1, "6"}, {1, "7"},  // 0x30
+  {1, "8"}, {1, "9"}, {1, ":"}, {1, ";"}, {1, "<"}, {1, "="}, {1, ">"}, {1, "?"},  // 0x38
+  {1, "@"}, {1, "A"}, {1, "B"}, {1, "C"}, {1, "D"}, {1, "E"}, {1, "F"}, {1, "G"},  // 0x40
+  {1, "H"}, {1, "I"}, {1, "J"}, {1, "K"}, {1, "L"}, {1, "M"}, {1, "N"}, {1, "O"},  // 0x48
+  {1, "P"}, {1, "Q"}, {1, "R"}, {1, "S"}, {1, "T"}, {1, "U"}, {1, "V"}, {1, "W"},  // 0x50
+  {1, "X"}, {1, "Y"}, {1, "Z"}, {1, "["}, {1, "\x5C"}, {1, "]"}, {3, "\xE2\x80\x95"}, {1, "_"},  // 0x58
+  {1, "`"}, {1, "a"}, {1, "b"}, {1, "c"}, {1, "d"}, {1, "e"}, {1, "f"}, {1, "g"},  // 0x60
+  {1, "h"}, {1, "i"}, {1, "j"}, {1, "k"}, {1, "l"}, {1, "m"}, {1, "n"}, {1, "o"},  // 0x68
+  {1, "p"}, {1, "q"}, {1, "r"}, {1, "s"}, {1, "t"}, {1, "u"}, {1, "v"}, {1, "w"},  // 0x70
+  {1, "x"}, {1, "y"}, {1, "z"}, {1, "{"}, {1, "|"}, {1, "}"}, {2, "\xC2\xAF"}, {1, " "},  // 0x78
+  {2, "\xC3\xA1"}, {2, "\xC3\xA0"}, {2, "\xC3\xA9"}, {2, "\xC3\xA8"}, {2, "\xC3\xAD"}, {2, "\xC3\xAC"}, {2, "\xC3\xB3"}, {2, "\xC3\xB2"},  // 0x80
+  {2, "\xC3\xBA"}, {2, "\xC3\xB9"}, {2, "\xC3\x91"}, {2, "\xC3\x87"}, {2, "\xC5\x9E"}, {2, "\xCE\xB2"}, {2, "\xC2\xA1"}, {2, "\xC4\xB2"},  // 0x88
+  {2, "\xC3\xA2"}, {2, "\xC3\xA4"}, {2, "\xC3\xAA"}, {2, "\xC3\xAB"}, {2, "\xC3\xAE"}, {2, "\xC3\xAF"}, {2, "\xC3\xB4"}, {2, "\xC3\xB6"},  // 0x90
+  {2, "\xC3\xBB"}, {2, "\xC3\xBC"}, {2, "\xC3\xB1"}, {2, "\xC3\xA7"}, {2, "\xC5\x9F"}, {2, "\xC7\xA7"}, {2, "\xC4\xB1"}, {2, "\xC4\xB3"},  // 0x98
+  {2, "\xC2\xAA"}, {2, "\xCE\xB1"}, {2, "\xC2\xA9"}, {3, "\xE2\x80\xB0"}, {2, "\xC7\xA6"}, {2, "\xC4\x9B"}, {2, "\xC5\x88"}, {2, "\xC5\x91"},  // 0xA0
+  {2, "\xCF\x80"}, {3, "\xE2\x82\xAC"}, {2, "\xC2\xA3"}, {1, "$"}, {3, "\xE2\x86\x90"}, {3, "\xE2\x86\x91"}, {3, "\xE2\x86\x92"}, {3, "\xE2\x86\x93"},  // 0xA8
+  {2, "\xC2\xBA"}, {2, "\xC2\xB9"}, {2, "\xC2\xB2"}, {2, "\xC2\xB3"}, {2, "\xC2\xB1"}, {2, "\xC4\xB0"}, {2, "\xC5\x84"}, {2, "\xC5\xB1"},  // 0xB0
+  {2, "\xC2\xB5"}, {2, "\xC2\xBF"}, {2, "\xC3\xB7"}, {2, "\xC2\xB0"}, {2, "\xC2\xBC"}, {2, "\xC2\xBD"}, {2, "\xC2\xBE"}, {2, "\xC2\xA7"},  // 0xB8
+  {2, "\xC3\x81"}, {2, "\xC3\x80"}, {2, "\xC3\x89"}, {2, "\xC3\x88"}, {2, "\xC3\x8D"}, {2, "\xC3\x8C"}, {2, "\xC3\x93"}, {2, "\xC3\x92"},  // 0xC0
+  {2, "\xC3\x9A"}, {2, "\xC3\x99"}, {2, "\xC5\x98"}, {2, "\xC4\x8C"}, {2, "\xC5\xA0"}, {2, "\xC5\xBD"}, {2, "\xC3\x90"}, {2, "\xC4\xBF"},  // 0xC8
+  {2, "\xC3\x82"}, {2, "\xC3\x84"}, {2, "\xC3\x8A"}, {2, "\xC3\x8B"}, {2, "\xC3\x8E"}, {2, "\xC3\x8F"}, {2, "\xC3\x94"}, {2, "\xC3\x96"},  // 0xD0
+  {2, "\xC3\x9B"}, {2, "\xC3\x9C"}, {2, "\xC5\x99"}, {2, "\xC4\x8D"}, {2, "\xC5\xA1"}, {2, "\xC5\xBE"}, {2, "\xC4\x91"}, {2, "\xC5\x80"},  // 0xD8
+  {2, "\xC3\x83"}, {2, "\xC3\x85"}, {2, "\xC3\x86"}, {2, "\xC5\x92"}, {2, "\xC5\xB7"}, {2, "\xC3\x9D"}, {2, "\xC3\x95"}, {2, "\xC3\x98"},  // 0xE0
+  {2, "\xC3\x9E"}, {2, "\xC5\x8A"}, {2, "\xC5\x94"}, {2, "\xC4\x86"}, {2, "\xC5\x9A"}, {2, "\xC5\xB9"}, {2, "\xC5\xA6"}, {2, "\xC3\xB0"},  // 0xE8
+  {2, "\xC3\xA3"}, {2, "\xC3\xA5"}, {2, "\xC3\xA6"}, {2, "\xC5\x93"}, {2, "\xC5\xB5"}, {2, "\xC3\xBD"}, {2, "\xC3\xB5"}, {2, "\xC3\xB8"},  // 0xF0
+  {2, "\xC3\xBE"}, {2, "\xC5\x8B"}, {2, "\xC5\x95"}, {2, "\xC4\x87"}, {2, "\xC5\x9B"}, {2, "\xC5\xBA"}, {2, "\xC5\xA7"}, {1, " "}  // 0xF8
+};
+
+// Per station decoder state. clearRDS() resets it as one block, so
+// flags are bitfields and every field here must be valid when zeroed
+// apart from the few clearRDS() sets afterwards.
+typedef struct _rdsstate_ {
+  unsigned long blockcounter[33];
+  uint32_t dabaffreq;
+  uint16_t correctPI;
+  uint16_t aid[10];
   byte stationTypeCode;
   byte MS;
-  String stationName;
-  String stationText;
-  String stationText32;
-  String RTContent1;
-  String RTContent2;
-  String PTYN;
-  String ECCtext;
-  String LICtext;
-  String stationIDtext;
-  String stationNameLong;
-  String stationStatetext;
-  String enhancedRTtext;
+  uint8_t ECC;
+  uint8_t LIC;
+  uint8_t rdsplusTag1;
+  uint8_t rdsplusTag2;
+  byte aid_counter;
+  byte pinMin;
+  byte pinHour;
+  byte pinDay;
   char stationType[18];
   char picode[7];
   char stationID[9];
-  char stationLongID[33];
   char stationState[3];
   char dabafeid[5];
   char dabafchannel[4];
-  unsigned long blockcounter[33];
-  uint16_t rdsA, rdsB, rdsC, rdsD, rdsErr, rdsStat, correctPI, rdsplusTag1, rdsplusTag2, PICTlock = 0;
-  bool ps12error, ps34error, ps56error, ps78error;
+  bool ps12error : 1;
+  bool ps34error : 1;
+  bool ps56error : 1;
+  bool ps78error : 1;
+  bool rdsAerror : 1;
+  bool rdsBerror : 1;
+  bool rdsCerror : 1;
+  bool rdsDerror : 1;
+  bool hasArtificialhead : 1;
+  bool hasCompressed : 1;
+  bool hasDynamicPTY : 1;
+  bool hasStereo : 1;
+  bool hasRDS : 1;
+  bool hasPIN : 1;
+  bool hasECC : 1;
+  bool hasLIC : 1;
+  bool hasDABAF : 1;
+  bool hasLongPS : 1;
+  bool hasRT : 1;
+  bool hasEnhancedRT : 1;
+  bool hasTP : 1;
+  bool hasTA : 1;
+  bool hasEON : 1;
+  bool hasAID : 1;
+  bool hasTMC : 1;
+  bool hasAF : 1;
+  bool hasCT : 1;
+  bool hasPTYN : 1;
+  bool rtAB : 1;
+  bool rtAB32 : 1;
+  bool hasRDSplus : 1;
+  bool rdsreset : 1;
+} rdsstate_;
+
+typedef struct _rds_ : _rdsstate_ {
+  RdsText<8 * RDS_UTF8_MAX> stationName;
+  RdsText<64 * RDS_UTF8_MAX> stationText;
+  RdsText<32 * RDS_UTF8_MAX> stationText32;
+  RdsText<44 * RDS_UTF8_MAX> RTContent1;
+  RdsText<44 * RDS_UTF8_MAX> RTContent2;
+  RdsText<8 * RDS_UTF8_MAX> PTYN;
+  RdsText<8> stationIDtext;
+  RdsText<32> stationNameLong;                                            // Sent as UTF-8
+  RdsText<2> stationStatetext;
+  RdsText<64 * RDS_UTF8_MAX> enhancedRTtext;
+  const char* ECCtext = "";                                               // Points into ECCtext[]
+  const char* LICtext = "";                                               // Points into LICtext[]
   time_t time;
   int32_t offset;
-  uint16_t aid[10];
-  uint32_t dabaffreq;
-  byte aid_counter;
+  uint16_t rdsA, rdsB, rdsC, rdsD, rdsErr, rdsStat, PICTlock = 0;
+  char stationLongID[33];
+  byte region;
   byte fastps;
-  unsigned int ECC;
-  unsigned int LIC;
-  byte pinMin;
-  byte pinHour;
-  byte pinDay;
-  bool rdsAerror;
-  bool rdsBerror;
-  bool rdsCerror;
-  bool rdsDerror;
-  bool hasArtificialhead;
-  bool hasCompressed;
-  bool hasDynamicPTY;
-  bool hasStereo;
-  bool hasRDS;
-  bool hasPIN;
-  bool hasECC;
-  bool hasLIC;
-  bool hasDABAF;
-  bool hasLongPS;
-  bool hasRT;
-  bool hasEnhancedRT;
-  bool hasTP;
-  bool hasTA;
-  bool hasEON;
-  bool hasAID;
-  bool hasTMC;
-  bool hasAF;
-  bool hasCT;
-  bool hasPTYN;
-  bool rtAB;
-  bool rtAB32;
-  bool hasRDSplus;
-  bool filter;
-  bool rdsreset;
+  bool filter;                                                            // Settings, kept over clearRDS()
   bool pierrors;
   bool ctupdate = true;
   bool sortaf;
   bool rtbuffer = true;
   bool afreg;
-  RdsPiBuffer piBuffer;
+  uint8_t piState = RdsPiBuffer<>::STATE_INVALID;                         // Confidence of rdsA, 0 is certain
+  RdsPiBuffer<RDS_PI_WINDOW> piBuffer;
 } rds_;
 
+typedef struct _quality_ {
+  uint16_t status;
+  int16_t level;
+  uint16_t usn;                                                           // AM: noise
+  uint16_t wam;                                                           // AM: co-channel
+  int16_t offset;
+  uint16_t bandwidth;
+  uint16_t modulation;
+  int8_t snr;
+  bool am;
+  bool valid;
+  unsigned long timestamp;
+} quality_;
+
+#define TUNE_SETTLE_TIMEOUT         100                                   // ms, preset tuning settles in ~32 ms
+#define TUNE_SETTLE_PRESET          320                                   // Quality timestamp (0.1 ms) of final preset, jump and check readings
+#define TUNE_SETTLE_SEARCH          100                                   // Search tuning: USN and WAM measured
+#define TUNE_SETTLE_AF              10                                    // AF update: the 1 ms snapshot is complete
+
+enum TEF_TUNE_STATE {
+  TUNE_IDLE,
+  TUNE_SETTLING,                                                          // Waiting for the quality timestamp to reach the settle time
+  TUNE_RDSWAIT,                                                           // Quality valid, waiting for RDS sync
+  TUNE_READY,
+  TUNE_TIMEOUT
+};
+
+typedef struct _tunestate_ {
+  uint8_t state;
+  uint8_t mode;                                                           // Tune_To mode: 1 preset, 2 search, 3 AF update, 4 jump
+  bool am;
+  bool rds;                                                               // RDS synchronised within rdswait
+  uint16_t frequency;
+  uint16_t rdswait;
+  uint16_t settle;                                                        // ms from tune command to first quality data
+  unsigned long start;
+} tunestate_;
+
+typedef struct _afflags_ {
+  bool afvalid : 1;
+  bool checked : 1;
+  bool regional : 1;
+  bool same : 1;
+} afflags_;
+
+#define AF_CHANNELS                 206                                   // 87.5 .. 108.0 MHz in 100 kHz steps
+#define AF_CHANNEL(f)               (((f) - 8750) / 10)
+
+#define AF_CHECK_FAST               250                                   // ms between AF measurements while the tuned channel is weak
+#define AF_CHECK_SLOW               2000                                  // ms between AF measurements otherwise
+#define AF_CHECK_SAMPLES            2                                     // Measurements of an AF before it can be switched to
+#define AF_CHECK_RDSWAIT            187                                   // ms in check mode for block A, two groups
+#define AF_SWITCH_MARGIN            70                                    // Gain in level - USN - WAM needed to switch
+
+enum TEF_AF_CHECK {
+  AFCHECK_IDLE,
+  AFCHECK_MEASURE,                                                        // AF update tune, ~1 ms audio gap
+  AFCHECK_PI,                                                             // Check tune, muted until block A is read
+  AFCHECK_SAMPLE                                                          // AF update tune of startSample()
+};
+
+// AF list as parallel arrays: the list scans only touch frequency[].
+// map[] has a bit per FM channel for the frequencies in the list. score[]
+// and trend[] are smoothed over the AF update measurements of serviceAF().
 typedef struct _af_ {
-  uint16_t  frequency;
-  int16_t score;
-  bool afvalid;
-  bool checked;
-  bool regional;
-  bool same;
+  uint16_t frequency[51];
+  int16_t score[51];
+  int16_t trend[51];                                                      // Score change per measurement
+  uint8_t samples[51];
+  afflags_ flag[51];
+  uint32_t map[(AF_CHANNELS + 31) / 32];
 } af_;
 
+typedef struct _eonflags_ {
+  bool ta : 1;
+  bool tp : 1;
+  bool taset : 1;
+  bool ptyset : 1;
+} eonflags_;
+
+#define EON_MAX                     20                                    // Networks kept, two pages of 10 on the EON screen
+#define EON_HASH_SIZE               32                                    // Power of two, more than EON_MAX keeps probes short
+#define EON_HASH(pi)                (((pi) ^ ((pi) >> 5) ^ ((pi) >> 10)) & (EON_HASH_SIZE - 1))
+#define EON_EMPTY                   0xFF
+
+// EON networks as parallel arrays, one entry per PI. hash[] finds the
+// entry of a PI by linear probing, order[] lists the entries by PI for
+// display. When full the least recently heard network is replaced.
 typedef struct _eon_ {
-  uint16_t  mappedfreq;
-  uint16_t  mappedfreq2;
-  uint16_t  mappedfreq3;
-  uint16_t  pi;
-  char picode[6];
-  String ps;
-  bool ta;
-  bool tp;
-  bool taset;
-  uint8_t pty;
-  bool ptyset;
+  uint16_t pi[EON_MAX];
+  uint16_t mappedfreq[EON_MAX];
+  uint16_t mappedfreq2[EON_MAX];
+  uint16_t mappedfreq3[EON_MAX];
+  uint8_t pty[EON_MAX];
+  eonflags_ flag[EON_MAX];
+  char picode[EON_MAX][6];
+  char psraw[EON_MAX][8];                                                 // PS segments as received
+  RdsText<8 * RDS_UTF8_MAX> ps[EON_MAX];
+  unsigned long lastseen[EON_MAX];                                        // millis() of the last 14A group
+  uint8_t hash[EON_HASH_SIZE];
+  uint8_t order[EON_MAX];
 } eon_;
 
-typedef struct _logbook_ {
-  char picode[6];
-  uint16_t frequency;
-  int16_t SignalLevel;
-  String stationName;
-  String DateTime;
-} logbook_;
+typedef struct _rdshandler_ {
+  bool enabled = true;
+  uint32_t calls;
+  uint32_t micros;                                                        // CPU time spent in the handler
+} rdshandler_;
 
 class TEF6686 {
   public:
-    af_  af[51];
-    eon_ eon[21];
+    af_  af;
+    eon_ eon;
     rds_ rds;
-    logbook_ logbook[22];
+    quality_ quality;
+    tunestate_ tune;
+    rdshandler_ rdshandler[RDS_HANDLER_COUNT];
     uint16_t TestAF();
     void TestAFEON();
+    uint16_t serviceAF(bool fast);
+    bool startSample(uint16_t frequency);
+    uint8_t pollSample(quality_ &sample);
+    bool isAF(uint16_t frequency);
+    int8_t findEON(uint16_t pi);
     void readRDS(byte showrdserrors);
-    void SetFreq(uint16_t frequency);
+    void setRDSHandlers(uint32_t mask);
+    const char* RDSHandlerName(uint8_t handler);
+    void resetRDSHandlerStats();
+    void SetFreq(uint16_t frequency, uint16_t rdswait = 0, bool search = false);
+    void startTune(uint16_t frequency, uint8_t mode, bool am = false, uint16_t rdswait = 0);
+    void watchRDS(uint16_t timeout);
+    uint8_t pollTune();
+    bool tuneDone();
+    bool waitTune();
     void SetFreqAM(uint16_t frequency);
     void SetFreqAIR(uint16_t frequency);
     bool getProcessing(uint16_t &highcut, uint16_t &stereo, uint16_t &sthiblend, uint8_t &stband_1, uint8_t &stband_2, uint8_t &stband_3, uint8_t &stband_4);
     bool getStatus(int16_t &level, uint16_t &USN, uint16_t &WAM, int16_t &offset, uint16_t &bandwidth, uint16_t &modulation, int8_t &snr);
     bool getStatusAM(int16_t &level, uint16_t &noise, uint16_t &cochannel, int16_t &offset, uint16_t &bandwidth, uint16_t &modulation, int8_t &snr);
+    const quality_ &getStatusIfOlderThan(uint16_t maxage, bool am = false);
+    unsigned long getStatusAge();
     bool getIdentification(uint16_t &device, uint16_t &hw_version, uint16_t &sw_version);
     void I2Sin(bool mode);
     void setSoftmuteFM(uint8_t mode);
@@ -728,11 +936,18 @@ class TEF6686 {
     void setVolume(int8_t volume);
     void tone(uint16_t time, int16_t amplitude, uint16_t frequency);
     void extendBW(bool yesno);
+    void invalidateShadow();
+    uint8_t applyProfile(const dspprofile_ &profile);
+    bool applyProfile(const char *name, uint8_t *sent = nullptr);
+    const char* profileName(uint8_t index);
     uint16_t getBlockA(void);
     String trimTrailingSpaces(String str);
+    uint16_t trimTrailingSpaces(const char* str, uint16_t length);
+    static uint16_t RDScharConverter(const char* input, size_t length, char* output, uint16_t size, bool under);
+    uint8_t PSconfidence(uint8_t pos);
+    uint8_t RTconfidence(uint8_t pos);
     uint8_t af_counter;
     uint8_t eon_counter;
-    uint8_t logbook_counter;
     uint8_t rdsblock;
     unsigned long processed_rdsblocks;
     bool mute;
@@ -740,18 +955,57 @@ class TEF6686 {
     byte underscore;
     bool ps_process;
     byte af_updatecounter;
+    byte eon_updatecounter;
+    uint32_t shadowsaved;
+    uint32_t qualityreads;
+    uint32_t qualitysaved;
 
   private:
-    void RDScharConverter(const char* input, wchar_t* output, size_t size, bool under);
-    String convertToUTF8(const wchar_t* input);
-    String extractUTF8Substring(const String& utf8String, size_t start, size_t length, bool under);
-    String ucs2ToUtf8(const char* ucs2Input);
+    bool readQuality(bool am, bool afdata = false);
+    typedef struct {
+      const char* name;
+      void (TEF6686::*decode)(byte showrdserrors);
+      uint32_t groups;                                                    // RDS_GROUP_MASK() of the group types handled
+    } rdsdecoder_;
+    static const rdsdecoder_ rdsdecoders[RDS_HANDLER_COUNT];
+    void decodeRDS(byte showrdserrors);
+    void decodePS(byte showrdserrors);
+    void decodeAF(byte showrdserrors);
+    bool addAF(uint16_t frequency);
+    int8_t findAF(uint16_t frequency);
+    void clearAF();
+    bool matchAFPI();
+    uint8_t addEON(uint16_t pi);
+    void removeEON(uint8_t x);
+    void clearEON();
+    void decodeSLC(byte showrdserrors);
+    void decodeRT(byte showrdserrors);
+    void decodeRT32(byte showrdserrors);
+    void decodeODA(byte showrdserrors);
+    void decodeCT(byte showrdserrors);
+    void decodePTYN(byte showrdserrors);
+    void decodeRTplus(byte showrdserrors);
+    void decodeERT(byte showrdserrors);
+    void decodeTMC(byte showrdserrors);
+    void decodeDABAF(byte showrdserrors);
+    void decodeEON(byte showrdserrors);
+    void decodeLongPS(byte showrdserrors);
+    void replayRDS(byte showrdserrors);
+    void resetRDS();
+    void armTune(uint16_t frequency, uint8_t mode, bool am, uint16_t rdswait);
+    bool shadowWrite(uint8_t reg, uint64_t value);
+    void shadowStore();
+    uint64_t shadow[SHADOW_COUNT];
+    uint32_t shadowseq[SHADOW_COUNT];                                     // TunerTask_Submitted() after the write
+    uint32_t shadowvalid;
+    uint32_t shadowfailed;                                                // tunerbusstats.failed when last checked
+    uint64_t shadowpending;
+    uint8_t shadowreg;
+    uint16_t extractUTF8Substring(char* utf8String, uint16_t size, size_t start, size_t length, bool under);
+    uint16_t ucs2ToUtf8(const char* ucs2Input, char* output, uint16_t size);
     bool isFixedCallsign(uint16_t stationID, char* stationIDStr);
-    String PSLongtext;
     char ps_buffer[9];
-    char ps_buffer2[9];
     char ptyn_buffer[9];
-    char eon_buffer[20][9];
     bool pslong_process;
     char eRT_buffer[129];
     bool rt_process;
@@ -760,6 +1014,9 @@ class TEF6686 {
     char rt_buffer32[33];
     char pslong_buffer[33];
     char pslong_buffer2[33];
+    RdsVote<8> psvote;
+    RdsVote<64> rtvote;
+    RdsVote<32> rt32vote;
     bool useRTPlus = true;
     bool ABold;
     bool afreset;
@@ -769,9 +1026,6 @@ class TEF6686 {
     uint16_t piold;
     bool rtABold;
     bool rtAB32old;
-    wchar_t PStext[9] = L"";
-    wchar_t EONPStext[20][9];
-    wchar_t PTYNtext[9] = L"";
     char RDSplus1[45];
     char RDSplus2[45];
     uint16_t  currentfreq;
@@ -786,6 +1040,14 @@ class TEF6686 {
     bool packet0, packet1, packet2, packet3, packet0long, packet1long, packet2long, packet3long;
     uint16_t previous_rdsA, previous_rdsB, previous_rdsC, previous_rdsD;
     bool afmethodBprobe;
+    bool afsorted;
+    uint8_t afcheck;
+    uint16_t afcheckfreq;
+    unsigned long afchecktimer;
+    unsigned long afcheckstart;                                           // RDS groups from afcheckstart to afcheckend belong to an AF
+    unsigned long afcheckend;
+    int16_t afmainscore;
+    quality_ mainquality;                                                 // Last reading of the tuned channel, never AF update data
     bool eRTcoding;
     uint16_t rdsCold;
     uint8_t af_counterb;
@@ -1,195 +1,179 @@
 #include "TEF6686.h"
-#include <stdarg.h>
 
 #define High_16bto8b(a) ((uint8_t)((a) >> 8))
 #define Low_16bto8b(a) ((uint8_t)(a ))
 #define Convert8bto16b(a) ((uint16_t)(((uint16_t)(*(a))) << 8 |((uint16_t)(*(a+1)))))
 
-void devTEF_Set_Cmd(TEF_MODULE module, uint8_t cmd, uint16_t len, ...) {
-  uint16_t i;
-  uint8_t buf[20];
-  uint16_t temp;
-  va_list vArgs;
-  va_start(vArgs, len);
-  buf[0] = module;
-  buf[1] = cmd;
-  buf[2] = 1;
-
-  for (i = 3; i < len; i++) {
-    temp = va_arg(vArgs, int);
-    buf[i++] = High_16bto8b(temp);
-    buf[i] = Low_16bto8b(temp);
-  }
-
-  va_end(vArgs);
-  Tuner_WriteBuffer(buf, len);
-}
-
 bool devTEF_Get_Cmd(TEF_MODULE module, uint8_t cmd, uint8_t *receive, uint16_t len) {
   uint8_t buf[3];
   buf[0] = module;
   buf[1] = cmd;
   buf[2] = 1;
 
+  TunerTask_Lock();                                                       // Request and answer must not be split
   Tuner_WriteBuffer(buf, 3);
-  return Tuner_ReadBuffer(receive, len);
+  bool r = Tuner_ReadBuffer(receive, len);
+  TunerTask_Unlock();
+  return r;
 }
 
 void devTEF_Radio_Tune_To (uint16_t frequency) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Tune_To, 7, 4, frequency);
+  devTEF_Send<FM_Tune_To>(4, frequency);
 }
 
 void devTEF_Radio_Tune_AM (uint16_t frequency) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Tune_To, 7, 1, frequency);
+  devTEF_Send<AM_Tune_To>(1, frequency);
 }
 
 void devTEF_Radio_Set_Bandwidth(uint8_t mode, uint16_t bandwidth) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Bandwidth, 7, mode, bandwidth);
+  devTEF_Send<FM_Set_Bandwidth>(mode, bandwidth);
 }
 
 void devTEF_Radio_Set_BandwidthAM(uint8_t mode, uint16_t bandwidth) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_Bandwidth, 7, mode, bandwidth);
+  devTEF_Send<AM_Set_Bandwidth>(mode, bandwidth);
 }
 
 void devTEF_Radio_Set_Noiseblanker_AM(uint8_t mode, uint16_t start) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_NoiseBlanker, 7, mode, start);
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_NoiseBlanker_Audio, 7, mode, 1000);
+  TEF_Batch<16> batch;
+  batch.add<AM_Set_NoiseBlanker>(mode, start);
+  batch.add<AM_Set_NoiseBlanker_Audio>(mode, 1000);
+  batch.send();
 }
 
 void devTEF_Radio_Set_Attenuator_AM(uint16_t start) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_Antenna, 5, start);
+  devTEF_Send<AM_Set_Antenna>(start);
 }
 
 void devTEF_Radio_Set_CoChannel_AM(uint8_t mode, uint16_t start, uint8_t level) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_CoChannelDet, 11, mode, 2, start, 1000, level);
+  devTEF_Send<AM_Set_CoChannelDet>(mode, 2, start, 1000);              // level was never part of the 4 word frame
 }
 
 void devTEF_Radio_Set_LevelOffset(int16_t offset) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_LevelOffset, 5, offset - 70);
+  devTEF_Send<FM_Set_LevelOffset>(offset - 70);
 }
 
 void devTEF_Radio_Set_AMLevelOffset(int16_t offset) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_LevelOffset, 5, offset - 70);
+  devTEF_Send<AM_Set_LevelOffset>(offset - 70);
 }
 
 void devTEF_Radio_Set_RDS(bool fullsearchrds) {
-  if (fullsearchrds) devTEF_Set_Cmd(TEF_FM, Cmd_Set_RDS, 9, 3, 1, 0); else devTEF_Set_Cmd(TEF_FM, Cmd_Set_RDS, 9, 1, 1, 0);
+  if (fullsearchrds) devTEF_Send<FM_Set_RDS>(3, 1, 0); else devTEF_Send<FM_Set_RDS>(1, 1, 0);
 }
 
 void devTEF_Radio_Set_Highcut_Level(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Level, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Highcut_Level>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_Highcut_Noise(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Noise, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Highcut_Noise>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_Highcut_Mph(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Mph, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Highcut_Mph>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_Highcut_Max(uint8_t mode, uint16_t limit) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Max, 7, mode, limit);
+  devTEF_Send<FM_Set_Highcut_Max>(mode, limit);
 }
 
 void devTEF_Radio_Set_StHiBlend_Level(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StHiBlend_Level, 9, mode, start, slope);
+  devTEF_Send<FM_Set_StHiBlend_Level>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_StHiBlend_Noise(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StHiBlend_Noise, 9, mode, start, slope);
+  devTEF_Send<FM_Set_StHiBlend_Noise>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_StHiBlend_Mph(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StHiBlend_Mph, 9, mode, start, slope);
+  devTEF_Send<FM_Set_StHiBlend_Mph>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_StHiBlend_Max(uint8_t mode, uint16_t limit) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StHiBlend_Max, 7, mode, limit);
+  devTEF_Send<FM_Set_StHiBlend_Max>(mode, limit);
 }
 
 void devTEF_Radio_Set_Stereo_Level(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Level, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Stereo_Level>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_NoisBlanker(uint8_t mode, uint16_t start) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_NoiseBlanker, 7, mode, start);
+  devTEF_Send<FM_Set_NoiseBlanker>(mode, start);
 }
 
 void devTEF_Radio_Set_Stereo_Noise(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Noise, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Stereo_Noise>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_Stereo_Mph(uint8_t mode, uint16_t start, uint16_t slope) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Mph, 9, mode, start, slope);
+  devTEF_Send<FM_Set_Stereo_Mph>(mode, start, slope);
 }
 
 void devTEF_Radio_Set_MphSuppression(bool mph) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_MphSuppression, 5, mph);
+  devTEF_Send<FM_Set_MphSuppression>(mph);
 }
 
 void devTEF_Radio_Set_ChannelEqualizer(bool eq) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_ChannelEqualizer, 5, eq);
+  devTEF_Send<FM_Set_ChannelEqualizer>(eq);
 }
 
 void devTEF_Radio_Extend_BW(bool yesno) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Bandwidth_Options, 5, (yesno ? 400 : 950));
+  devTEF_Send<FM_Set_Bandwidth_Options>(yesno ? 400 : 950);
 }
 
 void devTEF_Radio_Set_Stereo_Min(bool mode) {
-  if (mode) devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Min, 7, 2); else devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Min, 7, 0);
+  devTEF_Send<FM_Set_Stereo_Min>(mode ? 2 : 0, 400);
 }
 
 void devTEF_Radio_Set_RFAGC(uint16_t agc) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_RFAGC, 7, agc * 10, 0);
+  devTEF_Send<FM_Set_RFAGC>(agc * 10, 0);
 }
 
 void devTEF_Radio_Set_AMRFAGC(uint16_t agc) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_RFAGC, 7, agc * 10, 0);
+  devTEF_Send<AM_Set_RFAGC>(agc * 10, 0);
 }
 
 void devTEF_Radio_Set_Deemphasis(uint16_t timeconstant) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Deemphasis, 5, timeconstant);
+  devTEF_Send<FM_Set_Deemphasis>(timeconstant);
 }
 
 void devTEF_Radio_Specials(uint16_t audio) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Specials, 5, audio);
+  devTEF_Send<FM_Set_Specials>(audio);
 }
 
 void devTEF_Audio_Set_Volume(int16_t volume) {
-  devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Volume, 5, volume * 10);
+  devTEF_Send<AUDIO_Set_Volume>(volume * 10);
 }
 
 void devTEF_Audio_Set_Mute(uint8_t mode) {
-  devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Mute, 5, mode);
+  devTEF_Send<AUDIO_Set_Mute>(mode);
 }
 
 void devTEF_APPL_Set_OperationMode(bool mode) {
-  devTEF_Set_Cmd(TEF_APPL, Cmd_Set_OperationMode, 5, mode);
+  devTEF_Send<APPL_Set_OperationMode>(mode);
 }
 
 void devTEF_APPL_Set_StereoImprovement(bool mode) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StereoImprovement, 5, mode);
+  devTEF_Send<FM_Set_StereoImprovement>(mode);
 }
 
 void devTEF_APPL_Set_StereoBandBlend_Time(uint16_t attack, uint16_t decay) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StBandBlend_Time, 7, attack, decay);
+  devTEF_Send<FM_Set_StBandBlend_Time>(attack, decay);
 }
 
 void devTEF_APPL_Set_StereoBandBlend_Gain(uint16_t band1, uint16_t band2, uint16_t band3, uint16_t band4) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StBandBlend_Gain, 11, band1, band2, band3, band4);
+  devTEF_Send<FM_Set_StBandBlend_Gain>(band1, band2, band3, band4);
 }
 
 void devTEF_APPL_Set_StereoBandBlend_Bias(int16_t band1, int16_t band2, int16_t band3, int16_t band4) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_StBandBlend_Bias, 11, band1, band2, band3, band4);
+  devTEF_Send<FM_Set_StBandBlend_Bias>(band1, band2, band3, band4);
 }
 
 void devTEF_Radio_Set_Softmute_Max_FM(uint8_t mode) {
-  devTEF_Set_Cmd(TEF_FM, Cmd_Set_Softmute_Max, 7, uint16_t(mode), uint16_t(200));
+  devTEF_Send<FM_Set_Softmute_Max>(uint16_t(mode), uint16_t(200));
 }
 
 void devTEF_Radio_Set_Softmute_Max_AM(uint8_t mode) {
-  devTEF_Set_Cmd(TEF_AM, Cmd_Set_Softmute_Max, 7, uint16_t(mode), uint16_t(250));
+  devTEF_Send<AM_Set_Softmute_Max>(uint16_t(mode), uint16_t(250));
 }
 
 bool devTEF_APPL_Get_Operation_Status (uint8_t *bootstatus) {
@@ -230,10 +214,11 @@ bool devTEF_Radio_Get_Quality_Status (uint16_t *status, int16_t *level, uint16_t
   return r;
 }
 
-bool devTEF_Radio_Get_Quality_Status_AM (int16_t *level, uint16_t *noise, uint16_t *cochannel, int16_t *offset, uint16_t *bandwidth, uint16_t *mod, int8_t *snr) {
+bool devTEF_Radio_Get_Quality_Status_AM (uint16_t *status, int16_t *level, uint16_t *noise, uint16_t *cochannel, int16_t *offset, uint16_t *bandwidth, uint16_t *mod, int8_t *snr) {
   uint8_t buf[14];
   uint16_t r = devTEF_Get_Cmd(TEF_AM, Cmd_Get_Quality_Data, buf, sizeof(buf));
 
+  *status = Convert8bto16b(buf);
   *level = Convert8bto16b(buf + 2);
   *noise = Convert8bto16b(buf + 4);
   *cochannel = Convert8bto16b(buf + 6);
@@ -290,26 +275,28 @@ bool devTEF_Radio_Get_Identification (uint16_t *device, uint16_t *hw_version, ui
 }
 
 void devTEF_Radio_Set_Wavegen(bool mode, int16_t amplitude, uint16_t freq) {
+  TEF_Batch<24> batch;
   if (mode) {
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Input, 5, 240);
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_WaveGen, 15, 5, 0, amplitude * 10, freq, amplitude * 10 , freq);
+    batch.add<AUDIO_Set_Input>(240);
+    batch.add<AUDIO_Set_WaveGen>(5, 0, amplitude * 10, freq, amplitude * 10, freq);
   } else {
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Input, 5, 0);
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_WaveGen, 15, 0);
+    batch.add<AUDIO_Set_Input>(0);
+    batch.add<AUDIO_Set_WaveGen>(0, 0, 0, 0, 0, 0);
   }
+  batch.send();
 }
 
 void devTEF_Radio_Set_I2S_Input(bool mode) {
   if (mode) {
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Input, 5, 32);
+    devTEF_Send<AUDIO_Set_Input>(32);
   } else {
-    devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Input, 5, 0);
+    devTEF_Send<AUDIO_Set_Input>(0);
   }
 }
 
 void devTEF_Radio_Set_GPIO(uint8_t mode) {
-  if (mode == 0) devTEF_Set_Cmd(TEF_APPL, Cmd_Set_GPIO, 9, 0, 33, 2);
-  if (mode == 1) devTEF_Set_Cmd(TEF_APPL, Cmd_Set_GPIO, 9, 0, 33, 3);
-  if (mode == 2) devTEF_Set_Cmd(TEF_APPL, Cmd_Set_GPIO, 9, 0, 32, 2);
-  if (mode == 3) devTEF_Set_Cmd(TEF_APPL, Cmd_Set_GPIO, 9, 0, 32, 3);
+  if (mode == 0) devTEF_Send<APPL_Set_GPIO>(0, 33, 2);
+  if (mode == 1) devTEF_Send<APPL_Set_GPIO>(0, 33, 3);
+  if (mode == 2) devTEF_Send<APPL_Set_GPIO>(0, 32, 2);
+  if (mode == 3) devTEF_Send<APPL_Set_GPIO>(0, 32, 3);
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #ifndef TUNER_DRV_LITHIO_H
 #define TUNER_DRV_LITHIO_H
 
+#include <string.h>
+#include "Tuner_Interface.h"
+
 typedef enum {
   TEF_FM                      = 32,
   TEF_AM                      = 33,
@@ -62,10 +65,124 @@ typedef enum {
   Cmd_Get_Identification      = 130
 } TEF_APPL_COMMAND;
 
+// Command descriptors: module, command and parameter count are fixed at
+// compile time, so a frame is always 3 + 2 * params bytes and a call with the
+// wrong number of parameters does not compile.
+template <uint8_t Module, uint8_t Cmd, uint8_t Params>
+struct TEF_Command {
+  static const uint8_t module = Module;
+  static const uint8_t cmd = Cmd;
+  static const uint8_t params = Params;
+  static const uint8_t size = 3 + 2 * Params;
+};
+
+typedef TEF_Command<TEF_FM, Cmd_Tune_To, 2>                 FM_Tune_To;
+typedef TEF_Command<TEF_FM, Cmd_Set_Bandwidth, 2>           FM_Set_Bandwidth;
+typedef TEF_Command<TEF_FM, Cmd_Set_RFAGC, 2>               FM_Set_RFAGC;
+typedef TEF_Command<TEF_FM, Cmd_Set_MphSuppression, 1>      FM_Set_MphSuppression;
+typedef TEF_Command<TEF_FM, Cmd_Set_ChannelEqualizer, 1>    FM_Set_ChannelEqualizer;
+typedef TEF_Command<TEF_FM, Cmd_Set_NoiseBlanker, 2>        FM_Set_NoiseBlanker;
+typedef TEF_Command<TEF_FM, Cmd_Set_Deemphasis, 1>          FM_Set_Deemphasis;
+typedef TEF_Command<TEF_FM, Cmd_Set_StereoImprovement, 1>   FM_Set_StereoImprovement;
+typedef TEF_Command<TEF_FM, Cmd_Set_LevelOffset, 1>         FM_Set_LevelOffset;
+typedef TEF_Command<TEF_FM, Cmd_Set_Softmute_Max, 2>        FM_Set_Softmute_Max;
+typedef TEF_Command<TEF_FM, Cmd_Set_Highcut_Level, 3>       FM_Set_Highcut_Level;
+typedef TEF_Command<TEF_FM, Cmd_Set_Highcut_Noise, 3>       FM_Set_Highcut_Noise;
+typedef TEF_Command<TEF_FM, Cmd_Set_Highcut_Mph, 3>         FM_Set_Highcut_Mph;
+typedef TEF_Command<TEF_FM, Cmd_Set_Highcut_Max, 2>         FM_Set_Highcut_Max;
+typedef TEF_Command<TEF_FM, Cmd_Set_Stereo_Level, 3>        FM_Set_Stereo_Level;
+typedef TEF_Command<TEF_FM, Cmd_Set_Stereo_Noise, 3>        FM_Set_Stereo_Noise;
+typedef TEF_Command<TEF_FM, Cmd_Set_Stereo_Mph, 3>          FM_Set_Stereo_Mph;
+typedef TEF_Command<TEF_FM, Cmd_Set_Stereo_Min, 2>          FM_Set_Stereo_Min;
+typedef TEF_Command<TEF_FM, Cmd_Set_StHiBlend_Level, 3>     FM_Set_StHiBlend_Level;
+typedef TEF_Command<TEF_FM, Cmd_Set_StHiBlend_Noise, 3>     FM_Set_StHiBlend_Noise;
+typedef TEF_Command<TEF_FM, Cmd_Set_StHiBlend_Mph, 3>       FM_Set_StHiBlend_Mph;
+typedef TEF_Command<TEF_FM, Cmd_Set_StHiBlend_Max, 2>       FM_Set_StHiBlend_Max;
+typedef TEF_Command<TEF_FM, Cmd_Set_RDS, 3>                 FM_Set_RDS;
+typedef TEF_Command<TEF_FM, Cmd_Set_Specials, 1>            FM_Set_Specials;
+typedef TEF_Command<TEF_FM, Cmd_Set_Bandwidth_Options, 1>   FM_Set_Bandwidth_Options;
+typedef TEF_Command<TEF_FM, Cmd_Set_StBandBlend_Time, 2>    FM_Set_StBandBlend_Time;
+typedef TEF_Command<TEF_FM, Cmd_Set_StBandBlend_Gain, 4>    FM_Set_StBandBlend_Gain;
+typedef TEF_Command<TEF_FM, Cmd_Set_StBandBlend_Bias, 4>    FM_Set_StBandBlend_Bias;
+typedef TEF_Command<TEF_AM, Cmd_Tune_To, 2>                 AM_Tune_To;
+typedef TEF_Command<TEF_AM, Cmd_Set_Bandwidth, 2>           AM_Set_Bandwidth;
+typedef TEF_Command<TEF_AM, Cmd_Set_RFAGC, 2>               AM_Set_RFAGC;
+typedef TEF_Command<TEF_AM, Cmd_Set_Antenna, 1>             AM_Set_Antenna;
+typedef TEF_Command<TEF_AM, Cmd_Set_CoChannelDet, 4>        AM_Set_CoChannelDet;
+typedef TEF_Command<TEF_AM, Cmd_Set_NoiseBlanker, 2>        AM_Set_NoiseBlanker;
+typedef TEF_Command<TEF_AM, Cmd_Set_NoiseBlanker_Audio, 2>  AM_Set_NoiseBlanker_Audio;
+typedef TEF_Command<TEF_AM, Cmd_Set_LevelOffset, 1>         AM_Set_LevelOffset;
+typedef TEF_Command<TEF_AM, Cmd_Set_Softmute_Max, 2>        AM_Set_Softmute_Max;
+typedef TEF_Command<TEF_AUDIO, Cmd_Set_Volume, 1>           AUDIO_Set_Volume;
+typedef TEF_Command<TEF_AUDIO, Cmd_Set_Mute, 1>             AUDIO_Set_Mute;
+typedef TEF_Command<TEF_AUDIO, Cmd_Set_Input, 1>            AUDIO_Set_Input;
+typedef TEF_Command<TEF_AUDIO, Cmd_Set_WaveGen, 6>          AUDIO_Set_WaveGen;
+typedef TEF_Command<TEF_APPL, Cmd_Set_OperationMode, 1>     APPL_Set_OperationMode;
+typedef TEF_Command<TEF_APPL, Cmd_Set_GPIO, 3>              APPL_Set_GPIO;
+
+typedef struct _tefparam_ {
+  uint8_t high;
+  uint8_t low;
+} tefparam_;
+
+// Encoded command, laid out exactly as it goes over the bus
+template <class C>
+struct TEF_Frame {
+  uint8_t head[3];
+  tefparam_ param[C::params];
+};
+
+constexpr tefparam_ TEF_Param(uint16_t value) {
+  return tefparam_{uint8_t(value >> 8), uint8_t(value)};
+}
+
+template <class C, class... P>
+constexpr TEF_Frame<C> TEF_Encode(P... params) {
+  static_assert(sizeof...(P) == C::params, "wrong parameter count for this TEF command");
+  static_assert(sizeof(TEF_Frame<C>) == C::size, "TEF frame is not packed");
+  return TEF_Frame<C> {{C::module, C::cmd, 1}, {TEF_Param(params)...}};
+}
+
+template <class C>
+inline bool devTEF_Write(const TEF_Frame<C> &frame) {
+  return Tuner_WriteBuffer((unsigned char *)&frame, C::size);
+}
+
+template <class C, class... P>
+inline bool devTEF_Send(P... params) {
+  return devTEF_Write<C>(TEF_Encode<C>(params...));
+}
+
+// Frames queued as [length][frame] entries, the layout of the
+// tuner_init_tab tables, and handed to the bus in one Tuner_WriteBatch().
+template <uint16_t Capacity>
+class TEF_Batch {
+  public:
+    TEF_Batch() : size(0) {}
+
+    template <class C, class... P>
+    bool add(P... params) {
+      if (size + C::size + 1 > Capacity) return false;
+      const TEF_Frame<C> frame = TEF_Encode<C>(params...);
+      buf[size] = C::size;
+      memcpy(&buf[size + 1], &frame, C::size);
+      size += C::size + 1;
+      return true;
+    }
+
+    bool send() {
+      bool r = Tuner_WriteBatch(buf, size);
+      size = 0;
+      return r;
+    }
+
+    uint16_t size;
+    unsigned char buf[Capacity];
+};
+
 void devTEF_Radio_Set_RDS(bool fullsearchrds);
 void devTEF_Radio_Set_Softmute_Max_FM(uint8_t mode);
 void devTEF_Radio_Set_Softmute_Max_AM(uint8_t mode);
-void devTEF_Set_Cmd(TEF_MODULE module, uint8_t cmd, uint16_t len, ...);
 void devTEF_Radio_Tune_To (uint16_t frequency );
 void devTEF_Radio_Tune_AM (uint16_t frequency );
 void devTEF_Audio_Set_Mute(uint8_t mode);
@@ -109,7 +226,7 @@ void devTEF_Radio_Extend_BW(bool yesno);
 bool devTEF_Radio_Get_Identification (uint16_t *device, uint16_t *hw_version, uint16_t *sw_version);
 bool devTEF_Radio_Get_Quality_Status (uint16_t *status, int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod, int8_t *snr);
 bool devTEF_Radio_Get_Processing_Status (uint16_t *highcut, uint16_t *stereo, uint16_t *sthiblend, uint8_t *stband_1, uint8_t *stband_2, uint8_t *stband_3, uint8_t *stband_4);
-bool devTEF_Radio_Get_Quality_Status_AM (int16_t *level, uint16_t *noise, uint16_t *cochannel, int16_t *offset, uint16_t *bandwidth, uint16_t *mod, int8_t *snr);
+bool devTEF_Radio_Get_Quality_Status_AM (uint16_t *status, int16_t *level, uint16_t *noise, uint16_t *cochannel, int16_t *offset, uint16_t *bandwidth, uint16_t *mod, int8_t *snr);
 bool devTEF_APPL_Get_Operation_Status(uint8_t *bootstatus);
 bool devTEF_Radio_Get_Stereo_Status(uint16_t *status);
 bool devTEF_Radio_Get_RDS_Status(uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error);
@@ -1,9 +1,42 @@
 #include "TEF6686.h"
 #include "Tuner_Patch_Lithio_V102_p224.h"
 #include "Tuner_Patch_Lithio_V205_p512.h"
+#ifndef TUNER_HOST_BUILD
 #include <Wire.h>
+#endif
 
 bool Data_Accelerator = false;
+tunerbusstats_ tunerbusstats;
+tunerpacing_ tunerpacing[TUNER_PACING_SLOTS];
+tunerboot_ tunerboot;
+
+static tunerpacing_ *tunerlast = NULL;                                    // Command the chip may still be processing
+static uint32_t tunerlastend = 0;
+
+#ifndef TUNER_HOST_BUILD
+class WireTunerBus : public TunerBus {
+  public:
+    bool write(const uint8_t *buf, uint16_t len) {
+      Wire.beginTransmission(0x64);
+      for (uint16_t i = 0; i < len; i++) Wire.write(buf[i]);
+      return Wire.endTransmission() == 0;
+    }
+
+    bool read(uint8_t *buf, uint16_t len) {
+      Wire.requestFrom(0x64, len);
+      if (Wire.available() == len) {
+        for (uint16_t i = 0; i < len; i++) buf[i] = Wire.read();
+        return true;
+      }
+      return false;
+    }
+};
+
+static WireTunerBus wirebus;
+static TunerBus *tunerbus = &wirebus;
+#else
+static TunerBus *tunerbus = NULL;
+#endif
 
 const unsigned char tuner_init_tab[] PROGMEM = {
   9, 0x20, 0x36, 0x01, 0x00, 0x00, 0x01, 0x68, 0x01, 0x2C,
@@ -52,38 +85,192 @@ const unsigned char tuner_init_tab55000[] PROGMEM = {
   2, 0xff, 100,
 };
 
+const uint16_t tuner_init_tab_size = sizeof(tuner_init_tab);
+const uint16_t tuner_init_tab4000_size = sizeof(tuner_init_tab4000);
+const uint16_t tuner_init_tab9216_size = sizeof(tuner_init_tab9216);
+const uint16_t tuner_init_tab12000_size = sizeof(tuner_init_tab12000);
+const uint16_t tuner_init_tab55000_size = sizeof(tuner_init_tab55000);
+
+void Tuner_SetBus(TunerBus *bus) {
+  tunerbus = bus;
+}
+
+TunerBus *Tuner_GetBus() {
+  return tunerbus;
+}
+
+void Tuner_ResetBusStats() {
+  memset(&tunerbusstats, 0, sizeof(tunerbusstats));
+  for (uint8_t i = 0; i < TUNER_PACING_SLOTS; i++) {
+    tunerpacing[i].count = 0;
+    tunerpacing[i].naks = 0;
+    tunerpacing[i].waited = 0;
+    tunerpacing[i].maxgap = tunerpacing[i].gap;
+  }
+}
+
+static tunerpacing_ *Tuner_Pacing_Slot(const unsigned char *buf, uint16_t len) {
+  uint16_t key = (buf[0] << 8) | ((len > 1 && buf[0] >= TEF_FM) ? buf[1] : 0);
+  uint8_t slot = (key ^ (key >> 5)) % TUNER_PACING_SLOTS;
+
+  for (uint8_t i = 0; i < TUNER_PACING_SLOTS; i++) {
+    tunerpacing_ *p = &tunerpacing[(slot + i) % TUNER_PACING_SLOTS];
+    if (p->key == key) return p;
+    if (p->key == 0) {
+      p->key = key;
+      p->gap = TUNER_PACING_DEFAULT_US;
+      p->maxgap = p->gap;
+      return p;
+    }
+  }
+  return &tunerpacing[slot];                                              // Table full, share a slot
+}
+
+// Hold off until the previous command has had its learned processing time.
+static void Tuner_Pacing_Wait() {
+  if (tunerlast == NULL || Data_Accelerator) return;
+  uint32_t elapsed = micros() - tunerlastend;
+  if (elapsed < tunerlast->gap) {
+    uint32_t wait = tunerlast->gap - elapsed;
+    delayMicroseconds(wait);
+    tunerlast->waited += wait;
+  }
+}
+
+// The chip NAKs while it is still busy: widen the gap of the command it was
+// working on and back off. Every run of successes shaves the gap again, so
+// each command converges on the shortest spacing the tuner accepts.
+static void Tuner_Pacing_Nak(uint8_t attempt) {
+  uint16_t backoff = TUNER_PACING_BACKOFF_US << attempt;
+  if (tunerlast != NULL) {
+    tunerlast->naks++;
+    uint32_t gap = tunerlast->gap + backoff;
+    tunerlast->gap = gap > TUNER_PACING_MAX_US ? TUNER_PACING_MAX_US : gap;
+    if (tunerlast->gap > tunerlast->maxgap) tunerlast->maxgap = tunerlast->gap;
+    tunerlast->streak = 0;
+  }
+  delayMicroseconds(backoff);
+}
+
+static void Tuner_Pacing_Done(tunerpacing_ *p) {
+  if (tunerlast != NULL && ++tunerlast->streak >= TUNER_PACING_DECAY) {
+    tunerlast->streak = 0;
+    tunerlast->gap -= tunerlast->gap / 8;
+  }
+  if (p != NULL) p->count++;
+  tunerlast = p;                                                          // A completed read leaves the chip idle
+  tunerlastend = micros();
+}
+
 bool Tuner_WriteBuffer(unsigned char *buf, uint16_t len) {
-  Wire.beginTransmission(0x64);
-  for (uint16_t i = 0; i < len; i++) Wire.write(buf[i]);
-  uint8_t r = Wire.endTransmission();
-  if (!Data_Accelerator) delay(2);
-  return (r == 0) ? 1 : 0;
+  if (tunerbus == NULL || len == 0) return 0;
+  if (TunerTask_Queue(buf, len)) return true;
+  TunerTask_Lock();
+  tunerpacing_ *p = Tuner_Pacing_Slot(buf, len);
+  bool r = false;
+
+  for (uint8_t attempt = 0; attempt <= TUNER_PACING_RETRIES && !r; attempt++) {
+    Tuner_Pacing_Wait();
+    r = tunerbus->write(buf, len);
+    tunerbusstats.writes++;
+    tunerbusstats.bytesWritten += len;
+    if (!r) {
+      tunerbusstats.errors++;
+      Tuner_Pacing_Nak(attempt);
+    }
+  }
+  if (!r) tunerbusstats.failed++;
+  Tuner_Pacing_Done(p);
+  TunerTask_Unlock();
+  return r;
 }
 
 bool Tuner_ReadBuffer(unsigned char *buf, uint16_t len) {
-  Wire.requestFrom(0x64, len);
-  if (Wire.available() == len) {
-    for (uint16_t i = 0; i < len; i++) buf[i] = Wire.read();
-    return 1;
+  if (tunerbus == NULL) return 0;
+  TunerTask_Lock();
+  bool r = false;
+
+  for (uint8_t attempt = 0; attempt <= TUNER_PACING_RETRIES && !r; attempt++) {
+    Tuner_Pacing_Wait();
+    r = tunerbus->read(buf, len);
+    tunerbusstats.reads++;
+    tunerbusstats.bytesRead += len;
+    if (!r) {
+      tunerbusstats.errors++;
+      Tuner_Pacing_Nak(attempt);
+    }
   }
-  return 0;
+  Tuner_Pacing_Done(NULL);
+  TunerTask_Unlock();
+  return r;
 }
 
-static void Tuner_Patch_Load(const unsigned char *pLutBytes, uint16_t size) {
-  unsigned char buf[24 + 1];
+static bool Tuner_Patch_Load(const unsigned char *pLutBytes, uint16_t size, uint8_t chunk) {
+  unsigned char buf[TUNER_PATCH_CHUNK + 1];
   uint16_t i, len;
-  uint16_t r;
   buf[0] = 0x1b;
 
   while (size) {
-    len = (size > 24) ? 24 : size;
+    len = (size > chunk) ? chunk : size;
     size -= len;
 
     for (i = 0; i < len; i++) buf[1 + i] = pgm_read_byte(&pLutBytes[i]);
     pLutBytes += len;
 
-    if (1 != (r = Tuner_WriteBuffer(buf, len + 1))) break;
+    if (!Tuner_WriteBuffer(buf, len + 1)) return false;
+  }
+  return true;
+}
+
+// Expand an LZSS packed patch (see tools/patch_packer.py) straight into the
+// 0x1b write buffer. Only the back-reference window is kept in RAM.
+static bool Tuner_Patch_Unpack(const unsigned char *packed, uint16_t packedsize, uint16_t size, uint8_t chunk, uint32_t crc) {
+  unsigned char window[TUNER_LZ_WINDOW];
+  unsigned char buf[TUNER_PATCH_CHUNK + 1];
+  uint16_t in = 0, out = 0, wpos = 0;
+  uint8_t len = 0, flags = 0, bits = 0;
+  uint32_t sum = 0xFFFFFFFF;
+  buf[0] = 0x1b;
+
+  while (out < size) {
+    uint8_t count = 1;
+    uint16_t from = 0;
+    bool literal;
+
+    if (bits == 0) {
+      if (in >= packedsize) return false;
+      flags = pgm_read_byte(&packed[in++]);
+      bits = 8;
+    }
+    literal = flags & 1;
+    flags >>= 1;
+    bits--;
+
+    if (!literal) {
+      if (in + 1 >= packedsize) return false;
+      uint16_t token = (pgm_read_byte(&packed[in]) << 8) | pgm_read_byte(&packed[in + 1]);
+      in += 2;
+      from = wpos - (token >> 6) - 1;
+      count = (token & 0x3f) + 3;
+    } else if (in >= packedsize) {
+      return false;
+    }
+
+    while (count-- && out < size) {
+      unsigned char c = literal ? pgm_read_byte(&packed[in++]) : window[from++ & (TUNER_LZ_WINDOW - 1)];
+      window[wpos++ & (TUNER_LZ_WINDOW - 1)] = c;
+      buf[1 + len++] = c;
+      out++;
+      sum ^= c;
+      for (uint8_t k = 0; k < 8; k++) sum = (sum >> 1) ^ (0xEDB88320 & (0 - (sum & 1)));
+
+      if (len == chunk || out == size) {
+        if (!Tuner_WriteBuffer(buf, len + 1)) return false;
+        len = 0;
+      }
+    }
   }
+  return (sum ^ 0xFFFFFFFF) == crc;
 }
 
 bool Tuner_Table_Write(const unsigned char *tab) {
@@ -95,77 +282,91 @@ bool Tuner_Table_Write(const unsigned char *tab) {
   }
 }
 
+bool Tuner_WriteBatch(const unsigned char *batch, uint16_t size) {
+  for (uint16_t i = 0; i < size; i += batch[i] + 1) {
+    if (!Tuner_Table_Write(batch + i)) return false;
+  }
+  return true;
+}
+
 void Tuner_Reset(void) {
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1e);
-  Wire.write(0x5a);
-  Wire.write(0x01);
-  Wire.write(0x5a);
-  Wire.write(0x5a);
-  Wire.endTransmission();
-}
-
-void Tuner_Patch(byte TEF) {
-  Tuner_Reset();
-  delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
-  delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x74);
-  Wire.endTransmission();
-  switch (TEF) {
-    case 102:
-      Tuner_Patch_Load(pPatchBytes102, PatchSize102);
-      break;
+  unsigned char buf[5] = {0x1e, 0x5a, 0x01, 0x5a, 0x5a};
+  Tuner_WriteBuffer(buf, sizeof(buf));
+}
+
+static bool Tuner_Patch_Control(unsigned char mode) {
+  unsigned char buf[3] = {0x1c, 0x00, mode};
+  return Tuner_WriteBuffer(buf, sizeof(buf));
+}
+
+// Poll the operation status instead of sleeping a worst-case delay.
+bool Tuner_WaitStatus(uint8_t wanted, uint16_t timeout) {
+  unsigned long start = millis();
+  uint8_t bootstatus;
+
+  do {
+    if (devTEF_APPL_Get_Operation_Status(&bootstatus) && bootstatus == wanted) return true;
+    delay(1);
+  } while (millis() - start < timeout);
+  return false;
+}
+
+// First attempt streams large chunks and waits on the operation status; a
+// failed attempt falls back to the conservative 24 byte / fixed delay
+// sequence. The chip stays in boot state 0 until the start command in the
+// init tables, so a patch counts as verified when every transaction was
+// ACKed, the unpacked image matched its CRC and the chip still answers 0.
+bool Tuner_Patch(byte TEF) {
+  const unsigned char *patch, *lut;
+  uint16_t patchsize, packedsize, lutsize;
+  uint32_t crc;
+  unsigned long phase;
+  bool fast;
+  bool ok = false;
 
-    case 205:
-      Tuner_Patch_Load(pPatchBytes205, PatchSize205);
-      break;
-  }
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
-  delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x75);
-  Wire.endTransmission();
   switch (TEF) {
-    case 102:
-      Tuner_Patch_Load(pLutBytes102, LutSize102);
-      break;
+    case 102: patch = pPatchBytes102; patchsize = PatchSize102; packedsize = PatchPackedSize102; crc = PatchCrc102; lut = pLutBytes102; lutsize = LutSize102; break;
+    case 205: patch = pPatchBytes205; patchsize = PatchSize205; packedsize = PatchPackedSize205; crc = PatchCrc205; lut = pLutBytes205; lutsize = LutSize205; break;
+    default: return false;
+  }
+
+  for (tunerboot.attempts = 1; tunerboot.attempts <= 2 && !ok; tunerboot.attempts++) {
+    fast = (tunerboot.attempts == 1);
+
+    phase = millis();
+    Tuner_Reset();
+    if (!fast) delay(100);
+    ok = (!fast || Tuner_WaitStatus(0, 100)) && Tuner_Patch_Control(0x00);
+    if (fast) ok = ok && Tuner_WaitStatus(0, 100); else delay(100);
+    tunerboot.reset = millis() - phase;
 
-    case 205:
-      Tuner_Patch_Load(pLutBytes205, LutSize205);
-      break;
+    phase = millis();
+    ok = ok && Tuner_Patch_Control(0x74) && Tuner_Patch_Unpack(patch, packedsize, patchsize, fast ? TUNER_PATCH_CHUNK : 24, crc) && Tuner_Patch_Control(0x00);
+    tunerboot.patch = millis() - phase;
+
+    if (fast) ok = ok && Tuner_WaitStatus(0, 100); else delay(100);
+    phase = millis();
+    ok = ok && Tuner_Patch_Control(0x75) && Tuner_Patch_Load(lut, lutsize, fast ? TUNER_PATCH_CHUNK : 24) && Tuner_Patch_Control(0x00);
+    tunerboot.lut = millis() - phase;
+
+    if (ok) ok = Tuner_WaitStatus(0, 100);                                // Loaded, waiting for the start command
+    log_d("TEF668X patch attempt %d (%s): reset %d ms, patch %d ms, LUT %d ms, %s", tunerboot.attempts, fast ? "fast" : "safe", tunerboot.reset, tunerboot.patch, tunerboot.lut, ok ? "verified" : "failed");
   }
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
+  tunerboot.attempts--;
+  tunerboot.patched = ok;
+  return ok;
 }
 
 void Tuner_I2C_Init() {
+#ifndef TUNER_HOST_BUILD
   Wire.begin();
   Wire.setClock(400000);
   delay(5);
+#endif
 }
 
-void Tuner_Init(const unsigned char *table) {
-  uint16_t r;
-  const unsigned char *p = table;
-
-  for (uint16_t i = 0; i < sizeof(tuner_init_tab); i += (pgm_read_byte(p + i) + 1)) {
-    if (1 != (r = Tuner_Table_Write(p + i))) break;
+void Tuner_Init(const unsigned char *table, uint16_t size) {
+  for (uint16_t i = 0; i < size; i += (pgm_read_byte(table + i) + 1)) {
+    if (1 != Tuner_Table_Write(table + i)) break;
   }
 }
\ No newline at end of file
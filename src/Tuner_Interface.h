@@ -1,11 +1,75 @@
 #ifndef TUNER_INTERFACE_H
 #define TUNER_INTERFACE_H
 
+#include <stdint.h>
+
+// Transport underneath devTEF_Send/devTEF_Get_Cmd. The default backend
+// drives the TEF668x over Wire; a simulated chip (Tuner_Sim.h) can be
+// installed instead so everything above this layer runs off-target.
+class TunerBus {
+  public:
+    virtual bool write(const uint8_t *buf, uint16_t len) = 0;
+    virtual bool read(uint8_t *buf, uint16_t len) = 0;
+    virtual ~TunerBus() {}
+};
+
+typedef struct _tunerbusstats_ {
+  uint32_t writes;
+  uint32_t reads;
+  uint32_t bytesWritten;
+  uint32_t bytesRead;
+  uint32_t errors;                                                        // NAKed transactions, retries included
+  uint32_t failed;                                                        // Writes still failing after every retry
+} tunerbusstats_;
+
+#define TUNER_PACING_SLOTS          32
+#define TUNER_PACING_DEFAULT_US     500                                   // Gap for a command not seen before
+#define TUNER_PACING_BACKOFF_US     250
+#define TUNER_PACING_MAX_US         20000
+#define TUNER_PACING_RETRIES        6
+#define TUNER_PACING_DECAY          64                                    // Clean transactions before a gap shrinks
+
+// Per command (module << 8 | cmd) pacing state and timing statistics
+typedef struct _tunerpacing_ {
+  uint16_t key;
+  uint16_t gap;                                                           // Learned gap after this command, us
+  uint16_t maxgap;
+  uint8_t streak;
+  uint32_t count;
+  uint32_t naks;
+  uint32_t waited;                                                        // Total us spent waiting on this command
+} tunerpacing_;
+
+#define TUNER_PATCH_CHUNK           120                                   // Patch bytes per transaction, fits the Wire buffer
+#define TUNER_LZ_WINDOW             1024                                  // Packed patch back-reference window, power of 2
+
+// Boot phase timing in ms, filled by Tuner_Patch() and TEF6686::init()
+typedef struct _tunerboot_ {
+  uint8_t bootstatus;                                                     // Operation status found at power-up
+  uint8_t attempts;
+  bool patched;
+  uint16_t reset;
+  uint16_t patch;
+  uint16_t lut;
+  uint16_t init;
+  uint16_t total;
+} tunerboot_;
+
+extern tunerbusstats_ tunerbusstats;
+extern tunerboot_ tunerboot;
+extern tunerpacing_ tunerpacing[TUNER_PACING_SLOTS];
+
+void Tuner_SetBus(TunerBus *bus);
+TunerBus *Tuner_GetBus();
+void Tuner_ResetBusStats();
+
 void Tuner_I2C_Init();
-void Tuner_Patch(byte TEF);
-void Tuner_Init(const unsigned char *table);
+bool Tuner_Patch(byte TEF);
+bool Tuner_WaitStatus(uint8_t wanted, uint16_t timeout);
+void Tuner_Init(const unsigned char *table, uint16_t size);
 bool Tuner_WriteBuffer(unsigned char *buf, uint16_t len);
 bool Tuner_ReadBuffer(unsigned char *buf, uint16_t len);
 bool Tuner_Table_Write(const unsigned char *tab);
+bool Tuner_WriteBatch(const unsigned char *batch, uint16_t size);
 void Tuner_Reset(void);
 #endif
\ No newline at end of file
@@ -1,264 +1,207 @@
+// Generated by tools/patch_packer.py, LZSS packed (6108 -> 4618 bytes)
 extern const size_t PatchSize102;
+extern const size_t PatchPackedSize102;
+extern const uint32_t PatchCrc102;
 extern const unsigned char *pPatchBytes102;
 static const unsigned char PatchByteValues102[] PROGMEM = {
-  0xF0, 0x00, 0x38, 0x3B, 0xD0, 0x80, 0xF0, 0x00, 0x38, 0x43, 0xD0, 0x80, 0x43, 0xB2, 0x38, 0x46, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xC2, 0xF7,
-  0xF0, 0x00, 0x38, 0x77, 0xD0, 0x80, 0xF0, 0x00, 0x38, 0x7B, 0xDF, 0x80, 0x80, 0xFC, 0x39, 0x0E, 0xD0, 0x80, 0xC2, 0x38, 0x20, 0x11, 0x40, 0xB7,
-  0x9F, 0xA7, 0x39, 0x13, 0xD2, 0x80, 0x9F, 0xA7, 0x39, 0x1D, 0xD2, 0x80, 0xF0, 0x00, 0x39, 0x24, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x27, 0xD0, 0x80,
-  0x90, 0x41, 0x39, 0x49, 0xDD, 0x80, 0xF0, 0x00, 0x3A, 0x25, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x4D, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x27, 0xD0, 0x80,
-  0xC4, 0xA2, 0x02, 0x18, 0x60, 0x04, 0xF0, 0x00, 0x39, 0xBF, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0xE7, 0xD0, 0x80, 0x90, 0x01, 0x39, 0x4F, 0xD0, 0x80,
-  0xF0, 0x00, 0x38, 0xF0, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x56, 0xD2, 0x80, 0xF0, 0x00, 0x39, 0x5A, 0xD0, 0x80, 0x43, 0x84, 0x39, 0x64, 0xD0, 0x80,
-  0xF0, 0x00, 0x39, 0x67, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x6B, 0xD0, 0x80, 0x78, 0x4D, 0x39, 0x71, 0xD0, 0x80, 0x9E, 0x30, 0x18, 0xF9, 0xD2, 0x80,
-  0xF0, 0x00, 0x39, 0x76, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x79, 0xD0, 0x80, 0x30, 0x77, 0x39, 0xDE, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x7C, 0xD0, 0x80,
-  0x32, 0x00, 0x39, 0x7E, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0x80, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0xC7, 0xD0, 0x80, 0xF0, 0x00, 0x39, 0xF5, 0xD0, 0x80,
-  0xA8, 0x01, 0x3A, 0x13, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x32, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x39, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x3B, 0xD0, 0x80,
-  0xF0, 0x00, 0x3A, 0x4F, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x52, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x55, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x3A, 0x58, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3A, 0x5D, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0x1E, 0xD2, 0x80,
-  0xF0, 0x00, 0x3A, 0x6B, 0xD0, 0x80, 0x00, 0x43, 0x3A, 0x7A, 0xD9, 0x80, 0xF0, 0x00, 0x3A, 0x84, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0xDA, 0xD0, 0x80,
-  0xF0, 0x00, 0x3A, 0xDD, 0xD0, 0x80, 0xF0, 0x00, 0x3A, 0xEE, 0xD0, 0x80, 0x2E, 0x40, 0x3B, 0x8C, 0xD0, 0x80, 0xF0, 0x00, 0x3B, 0x96, 0xD0, 0x80,
-  0xF0, 0x00, 0x0E, 0x3F, 0x60, 0x00, 0x50, 0x10, 0x28, 0xD8, 0xD2, 0x80, 0x91, 0x01, 0x01, 0x36, 0x60, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xA0, 0x18,
-  0xF0, 0x00, 0x70, 0x00, 0xA0, 0xCC, 0xF0, 0x00, 0x70, 0x00, 0xA0, 0xED, 0xF0, 0x00, 0x70, 0x00, 0xA1, 0xAE, 0xF0, 0x00, 0x70, 0x00, 0xA2, 0x02,
-  0xF0, 0x00, 0x70, 0x00, 0xA2, 0x2D, 0xF0, 0x00, 0x70, 0x00, 0xA2, 0x45, 0xF0, 0x00, 0x20, 0x31, 0xD0, 0x80, 0xF0, 0x00, 0x04, 0xC1, 0x60, 0x08,
-  0xF0, 0x00, 0x01, 0x01, 0xD2, 0x80, 0xF0, 0x00, 0x00, 0x30, 0xD0, 0x80, 0x00, 0x7F, 0x60, 0x02, 0xE2, 0x00, 0xF0, 0x00, 0x0E, 0x22, 0x60, 0x0A,
-  0xF0, 0x00, 0x00, 0xFF, 0x60, 0x03, 0xF0, 0x00, 0x01, 0x42, 0xD2, 0x80, 0x90, 0x03, 0x40, 0x02, 0xF0, 0x00, 0x90, 0x43, 0x01, 0x70, 0xD1, 0x80,
-  0xF0, 0x00, 0x01, 0x69, 0xD0, 0x80, 0x0E, 0x69, 0x60, 0x0A, 0xA3, 0x4C, 0x20, 0x23, 0x00, 0x01, 0x60, 0x01, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00,
-  0xC4, 0xCB, 0x70, 0x00, 0xF0, 0x00, 0xCA, 0x09, 0x30, 0x23, 0xF0, 0x00, 0xC2, 0xCB, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x23, 0xD0, 0x08,
-  0x82, 0x00, 0x0D, 0x50, 0x60, 0x08, 0xF0, 0x00, 0x0D, 0x51, 0x60, 0x09, 0x30, 0x00, 0x21, 0x80, 0x60, 0x01, 0xF0, 0x00, 0x40, 0x32, 0xF0, 0x00,
-  0x30, 0x11, 0x45, 0xF3, 0xF0, 0x00, 0x30, 0x92, 0x2D, 0x30, 0x60, 0x04, 0x31, 0x13, 0x2D, 0x40, 0x60, 0x05, 0x31, 0x94, 0x7F, 0xFF, 0x60, 0x06,
-  0x32, 0x15, 0x0D, 0x61, 0x60, 0x0A, 0x32, 0x96, 0x0D, 0x6B, 0x60, 0x0B, 0x33, 0x10, 0x0D, 0x50, 0x60, 0x01, 0x33, 0x90, 0x0D, 0x5C, 0x60, 0x02,
-  0x30, 0x21, 0x0D, 0x63, 0x60, 0x03, 0x30, 0x31, 0x0D, 0x75, 0x60, 0x0C, 0x30, 0xA2, 0x8D, 0x00, 0x60, 0x01, 0x30, 0xB3, 0x01, 0x73, 0x60, 0x02,
-  0x30, 0x41, 0x00, 0x25, 0x60, 0x03, 0x30, 0xC2, 0x40, 0x44, 0xF0, 0x00, 0x31, 0x43, 0x40, 0x35, 0xF0, 0x00, 0x31, 0xC4, 0x64, 0x00, 0x60, 0x06,
-  0x32, 0x45, 0x1F, 0x40, 0x60, 0x07, 0x32, 0xC6, 0x70, 0x00, 0xF0, 0x00, 0x33, 0x47, 0x1E, 0xBC, 0x60, 0x0D, 0x33, 0xC0, 0x01, 0x22, 0x60, 0x01,
-  0x34, 0x40, 0xFD, 0xEE, 0x60, 0x02, 0x30, 0x51, 0x7B, 0x8F, 0x60, 0x03, 0x30, 0xD2, 0xC4, 0x29, 0x60, 0x04, 0x31, 0x51, 0x1E, 0xC2, 0x60, 0x0E,
-  0x32, 0x53, 0xFF, 0x0D, 0x60, 0x02, 0x32, 0xD4, 0x7D, 0x2E, 0x60, 0x03, 0x30, 0x61, 0xC1, 0x9A, 0x60, 0x04, 0x30, 0xE2, 0x70, 0x00, 0xF0, 0x00,
-  0x31, 0x61, 0x70, 0x00, 0xF0, 0x00, 0x32, 0x63, 0x05, 0x2C, 0x60, 0x08, 0x32, 0xE4, 0x40, 0x00, 0x83, 0x22, 0xF0, 0x00, 0x03, 0x70, 0xD2, 0x80,
-  0xF0, 0x00, 0x70, 0x00, 0xA0, 0x08, 0xF0, 0x00, 0x70, 0x00, 0xA0, 0x4D, 0xF0, 0x00, 0x02, 0x15, 0xD0, 0x80, 0x40, 0x15, 0x20, 0x53, 0xA3, 0x1E,
-  0xA0, 0xE8, 0x58, 0x06, 0xA3, 0x1D, 0xA0, 0x72, 0x20, 0x64, 0xF0, 0x00, 0xA8, 0x61, 0x70, 0x00, 0xF0, 0x00, 0xA1, 0x28, 0x70, 0x00, 0xF0, 0x00,
-  0xA0, 0xB2, 0x02, 0xBB, 0xD0, 0x80, 0xF0, 0x00, 0x0D, 0x51, 0x60, 0x0F, 0xF0, 0x00, 0x05, 0x17, 0x60, 0x0E, 0x23, 0xF6, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x21, 0x63, 0x41, 0xF5, 0x91, 0x8F, 0x21, 0xF8, 0x40, 0x74, 0xC3, 0xEF, 0x21, 0xE0, 0xF0, 0x00, 0xC3, 0xA4, 0x33, 0xF7, 0xF0, 0x00,
-  0xD8, 0x5B, 0x70, 0x00, 0xF0, 0x00, 0x82, 0x18, 0x70, 0x00, 0xF0, 0x00, 0x9F, 0xAF, 0x18, 0x00, 0xF0, 0x00, 0x9F, 0x0F, 0x31, 0xF8, 0x90, 0x02,
-  0xF0, 0x00, 0x70, 0x00, 0x90, 0x28, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x22, 0x78, 0xF0, 0x00, 0x16, 0xD3, 0x60, 0x09, 0xA0, 0x6D,
-  0x35, 0xF0, 0x1E, 0xBC, 0x60, 0x0D, 0xF0, 0x00, 0x0D, 0x61, 0x60, 0x08, 0xF0, 0x00, 0x03, 0xA5, 0xD2, 0x80, 0xF0, 0x00, 0x1E, 0xC2, 0x60, 0x0D,
-  0xF0, 0x00, 0x0D, 0x6B, 0x60, 0x08, 0xF0, 0x00, 0x03, 0xA5, 0xD2, 0x80, 0xF0, 0x00, 0x21, 0x00, 0xF0, 0x00, 0x83, 0x6D, 0x22, 0xF1, 0xF0, 0x00,
-  0xF0, 0x00, 0x23, 0x77, 0xF0, 0x00, 0x90, 0x41, 0x36, 0x70, 0xF0, 0x00, 0x9E, 0x79, 0x70, 0x00, 0x90, 0x01, 0xF0, 0x00, 0x32, 0xF1, 0xD0, 0x08,
-  0x91, 0xC7, 0x33, 0x75, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0x70, 0xE6, 0x00, 0xF0, 0x00, 0x34, 0xF0, 0xE6, 0x00, 0xF0, 0x00, 0x24, 0x74, 0xF0, 0x00,
-  0xF0, 0x00, 0x24, 0xF3, 0xF0, 0x00, 0x8C, 0x24, 0x26, 0xF2, 0x40, 0x16, 0x8A, 0x1B, 0x34, 0x74, 0x4F, 0xF5, 0x82, 0xB7, 0x34, 0xF3, 0xF0, 0x00,
-  0xF0, 0x00, 0x20, 0x71, 0x90, 0x05, 0x83, 0x04, 0x70, 0x00, 0xF0, 0x00, 0x8E, 0x67, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x90, 0x02,
-  0xF0, 0x00, 0x36, 0xF6, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0xF0, 0x80, 0x06, 0x82, 0xAF, 0x70, 0x00, 0xF0, 0x00, 0x82, 0x1B, 0x70, 0x00, 0xD0, 0x09,
-  0x8E, 0x5F, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x09, 0xF0, 0x00, 0x36, 0xF5, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0x70, 0xF0, 0x00,
-  0x40, 0x11, 0x27, 0x72, 0xA2, 0xE9, 0x90, 0x8A, 0x20, 0xF3, 0xA2, 0xE8, 0x8E, 0xD7, 0x37, 0x72, 0xF0, 0x00, 0xF0, 0x00, 0x37, 0xF1, 0xE6, 0x00,
-  0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x22, 0x7A, 0xF0, 0x00, 0x16, 0xC3, 0x60, 0x09, 0xA0, 0x46, 0xF0, 0x00, 0x18, 0x20, 0xF0, 0x00,
-  0xF0, 0x00, 0x35, 0x70, 0xF0, 0x00, 0xF0, 0x00, 0x32, 0x7A, 0xD0, 0x08, 0x0D, 0x51, 0x60, 0x08, 0xA2, 0xDF, 0x82, 0x00, 0x21, 0x06, 0x40, 0x03,
-  0x33, 0x80, 0x0D, 0x63, 0x60, 0x09, 0x37, 0x00, 0x0D, 0x6D, 0x60, 0x0A, 0x37, 0x80, 0x0D, 0x30, 0x60, 0x0B, 0x36, 0x83, 0x0D, 0x40, 0x60, 0x0C,
-  0x35, 0x80, 0x70, 0x00, 0xC8, 0x88, 0xF0, 0x00, 0x10, 0x10, 0xF0, 0x00, 0xF0, 0x00, 0x10, 0x20, 0xF0, 0x00, 0x32, 0x86, 0x40, 0x15, 0xC8, 0x90,
-  0xF0, 0x00, 0x10, 0x30, 0xF0, 0x00, 0xF0, 0x00, 0x10, 0x40, 0xF0, 0x00, 0xF0, 0x00, 0x33, 0x05, 0xD0, 0x08, 0xF0, 0x00, 0x0D, 0x75, 0x60, 0x0F,
-  0xF0, 0x00, 0x05, 0x63, 0x60, 0x0E, 0x24, 0xF7, 0x05, 0x1D, 0x60, 0x0D, 0x25, 0x76, 0x70, 0x00, 0xF0, 0x00, 0x91, 0xC7, 0x20, 0xE8, 0x40, 0x15,
-  0x91, 0x8F, 0x21, 0xE9, 0xD4, 0x09, 0xC3, 0xEF, 0x20, 0x00, 0x40, 0x12, 0x9F, 0xBE, 0x20, 0x11, 0x58, 0x03, 0xA0, 0x80, 0x35, 0x77, 0x90, 0x01,
-  0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x21, 0xF5, 0xF0, 0x00, 0xA0, 0xCA, 0x22, 0x54, 0xF0, 0x00, 0xCC, 0x09, 0x05, 0x17, 0x60, 0x0C,
-  0x83, 0x2C, 0x70, 0x00, 0xF0, 0x00, 0x8A, 0x61, 0x70, 0x00, 0xF0, 0x00, 0xAE, 0x48, 0x22, 0x45, 0xA2, 0xC3, 0xA2, 0x28, 0x20, 0x78, 0xF0, 0x00,
-  0xF0, 0x00, 0x35, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0x18, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x78, 0xF0, 0x00, 0x16, 0xE3, 0x60, 0x09, 0xA0, 0x27,
-  0x89, 0x01, 0x23, 0xF4, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0xF2, 0xF0, 0x00, 0x82, 0x61, 0x21, 0x73, 0xF0, 0x00, 0xA0, 0x50, 0x36, 0x70, 0xF0, 0x00,
-  0xA0, 0x58, 0x23, 0x72, 0xE1, 0x40, 0xA8, 0x01, 0x22, 0xF3, 0xF0, 0x00, 0x90, 0x49, 0x22, 0x75, 0xE0, 0x40, 0x80, 0x61, 0x70, 0x00, 0xF0, 0x00,
-  0x8A, 0x51, 0x33, 0xF1, 0xF0, 0x00, 0xA0, 0x58, 0x70, 0x00, 0xF0, 0x00, 0xAF, 0x48, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0x70, 0xD0, 0x08,
-  0x82, 0x00, 0x0D, 0x75, 0x60, 0x08, 0x90, 0x09, 0x0D, 0x00, 0x60, 0x09, 0xF0, 0x00, 0x35, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x33, 0x80, 0xC0, 0x28,
-  0xF0, 0x00, 0x10, 0x10, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0x81, 0xD0, 0x08, 0x82, 0x49, 0x0D, 0x75, 0x60, 0x08, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xFD,
-  0x04, 0x00, 0x60, 0x00, 0xA2, 0xA9, 0x8E, 0xC0, 0x40, 0x00, 0x60, 0x05, 0x60, 0x00, 0x60, 0x05, 0xE6, 0x00, 0xC8, 0x1B, 0x70, 0x00, 0xF0, 0x00,
-  0xD8, 0xDB, 0x0D, 0x51, 0x60, 0x08, 0x83, 0x5B, 0x70, 0x00, 0xF0, 0x00, 0x9E, 0xBA, 0x30, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x84, 0xD4, 0x09,
-  0xF0, 0x00, 0x70, 0x00, 0x8F, 0xC1, 0xF0, 0x00, 0x0D, 0x75, 0x60, 0x08, 0xF0, 0x00, 0x0D, 0x51, 0x60, 0x09, 0xF0, 0x00, 0x24, 0x03, 0xF0, 0x00,
-  0xF0, 0x00, 0x27, 0x94, 0xD0, 0x08, 0xA0, 0x03, 0x70, 0x00, 0xF0, 0x00, 0x00, 0x11, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x11, 0x08, 0x00, 0xC0, 0x0E,
-  0xA0, 0x09, 0x00, 0x11, 0x08, 0x00, 0xA0, 0x09, 0x70, 0x00, 0xF0, 0x00, 0xA4, 0x08, 0x70, 0x00, 0xD0, 0x08, 0xA0, 0x03, 0x70, 0x00, 0xF0, 0x00,
-  0x00, 0x11, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x11, 0x08, 0x00, 0xC0, 0x26, 0xA0, 0x09, 0x00, 0x11, 0x08, 0x00, 0xA0, 0x09, 0x70, 0x00, 0xF0, 0x00,
-  0xA4, 0x08, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x1D, 0x01, 0x60, 0x08, 0xF0, 0x00, 0x0A, 0x2C, 0x60, 0x00, 0xF0, 0x00, 0x01, 0x1A, 0x60, 0x01,
-  0x31, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x31, 0x81, 0x70, 0x00, 0xD0, 0x08, 0xA8, 0x01, 0x7F, 0xFF, 0x60, 0x06, 0xCC, 0x0A, 0x70, 0x00, 0xF0, 0x00,
-  0x8E, 0xA1, 0x31, 0x06, 0xF0, 0x00, 0xF0, 0x00, 0x32, 0x06, 0xD4, 0x09, 0xAE, 0xE8, 0x04, 0xDF, 0xD0, 0x80, 0x90, 0x87, 0x70, 0x00, 0x98, 0x07,
-  0xF0, 0x00, 0x0F, 0xB1, 0xD2, 0x80, 0x9E, 0x08, 0x41, 0x89, 0x60, 0x06, 0x14, 0x92, 0x60, 0x00, 0x90, 0x04, 0xA1, 0x98, 0x1D, 0x01, 0x60, 0x08,
-  0xAA, 0x56, 0x70, 0x00, 0xF0, 0x00, 0xA2, 0x20, 0x32, 0x06, 0xF0, 0x00, 0xF0, 0x00, 0x32, 0x80, 0xF0, 0x00, 0x91, 0xC2, 0x06, 0x9A, 0x60, 0x08,
-  0x41, 0xE6, 0x06, 0x00, 0xD0, 0x80, 0x82, 0x13, 0x70, 0x00, 0xD8, 0x09, 0xF0, 0x00, 0x0F, 0xB1, 0xD2, 0x80, 0x9E, 0x08, 0x10, 0x62, 0x60, 0x01,
-  0x05, 0x1F, 0x60, 0x05, 0xD0, 0x09, 0xF0, 0x00, 0x06, 0xE6, 0x60, 0x08, 0xA3, 0x65, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x85, 0xD0, 0x08,
-  0x10, 0x00, 0x60, 0x03, 0xA2, 0x75, 0x30, 0x23, 0x07, 0x73, 0xD2, 0x80, 0xF0, 0x00, 0x07, 0xC6, 0xD0, 0x80, 0x08, 0x00, 0x60, 0x03, 0xA0, 0x02,
-  0x0E, 0x6F, 0x60, 0x09, 0xF0, 0x00, 0x02, 0x00, 0x60, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x07, 0x73, 0xD0, 0x80, 0x40, 0xE0, 0x00, 0x1F, 0x60, 0x01,
-  0x13, 0xD5, 0x60, 0x07, 0xA0, 0x11, 0x90, 0x40, 0x70, 0x00, 0xF0, 0x00, 0x13, 0xFB, 0x60, 0x06, 0xA0, 0x0E, 0x14, 0x05, 0x60, 0x06, 0xA0, 0x0D,
-  0x14, 0x0F, 0x60, 0x06, 0xA0, 0x0C, 0x45, 0x60, 0x00, 0x3A, 0x60, 0x01, 0x13, 0xB6, 0x60, 0x07, 0xA0, 0x0B, 0x90, 0x40, 0x70, 0x00, 0xF0, 0x00,
-  0x13, 0xF7, 0x60, 0x06, 0xA0, 0x08, 0x14, 0x01, 0x60, 0x06, 0xA0, 0x07, 0x14, 0x0B, 0x60, 0x06, 0xA0, 0x06, 0x41, 0x80, 0x00, 0x3B, 0x60, 0x01,
-  0x13, 0xB6, 0x60, 0x07, 0xA0, 0x05, 0x90, 0x40, 0x70, 0x00, 0xF0, 0x00, 0x13, 0xF7, 0x60, 0x06, 0xA0, 0x02, 0x14, 0x01, 0x60, 0x06, 0xA0, 0x01,
-  0x14, 0x0B, 0x60, 0x06, 0x80, 0x00, 0xF0, 0x00, 0x0D, 0x28, 0xD0, 0x80, 0xD7, 0xCA, 0x00, 0xFF, 0x60, 0x04, 0x81, 0xD7, 0x0C, 0xF7, 0x60, 0x09,
-  0xD0, 0x56, 0x70, 0x00, 0xF0, 0x00, 0x82, 0x76, 0x30, 0x17, 0xF0, 0x00, 0xD0, 0xF6, 0x40, 0x83, 0xF0, 0x00, 0xC1, 0xA4, 0x20, 0x19, 0xF0, 0x00,
-  0x82, 0xF6, 0x70, 0x00, 0xF0, 0x00, 0xC1, 0x80, 0x20, 0x17, 0xA2, 0x54, 0xC3, 0xE7, 0x70, 0x00, 0xF0, 0x00, 0xC5, 0xC7, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x30, 0x17, 0xD0, 0x08, 0x9A, 0x78, 0x70, 0x00, 0xF0, 0x00, 0x9A, 0x70, 0x70, 0x00, 0x90, 0xE3, 0xF0, 0x00, 0x70, 0x00, 0x90, 0xE3,
-  0xF0, 0x00, 0x0D, 0x67, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xA1, 0x19, 0xF0, 0x00, 0x70, 0x00, 0x80, 0xD2, 0x1E, 0xC8, 0x60, 0x08, 0xA2, 0x4A,
-  0xF0, 0x00, 0x20, 0x00, 0xA2, 0x49, 0x90, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xD4, 0x09, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xA5,
-  0x1E, 0xC8, 0x60, 0x08, 0xA2, 0x45, 0xF0, 0x00, 0x30, 0x00, 0xD0, 0x08, 0x00, 0x28, 0x60, 0x00, 0xA2, 0x43, 0x9E, 0x38, 0x0E, 0xF4, 0x60, 0x09,
-  0x9E, 0x38, 0x70, 0x00, 0x9F, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0x40, 0x40, 0x0C, 0x8A, 0xD5, 0x80, 0xF0, 0x00, 0x0C, 0x8B, 0xD2, 0x80,
-  0xF0, 0x00, 0x0F, 0xB1, 0xD2, 0x80, 0x9C, 0x39, 0x70, 0x00, 0xF0, 0x00, 0x9C, 0x31, 0x70, 0x00, 0x90, 0x03, 0xF0, 0x00, 0x70, 0x00, 0x90, 0x02,
-  0x40, 0x10, 0x70, 0x00, 0xAF, 0xF3, 0x41, 0xF1, 0x40, 0x40, 0x80, 0x0D, 0x40, 0x00, 0x70, 0x00, 0xAF, 0xF1, 0x41, 0xF1, 0x40, 0x40, 0x80, 0x0C,
-  0x03, 0xE8, 0x60, 0x02, 0xA2, 0x35, 0x90, 0x83, 0x10, 0x44, 0xD1, 0x80, 0xF0, 0x00, 0x10, 0x42, 0xD0, 0x80, 0x40, 0x71, 0x40, 0x20, 0xA0, 0x08,
-  0x43, 0xA1, 0x40, 0x30, 0xA0, 0x07, 0x43, 0xB1, 0x40, 0x30, 0xA0, 0x06, 0xF0, 0x00, 0x10, 0x75, 0xD0, 0x80, 0x40, 0x71, 0x40, 0x20, 0xA0, 0x04,
-  0x43, 0xA1, 0x40, 0x30, 0xA0, 0x02, 0x43, 0xB1, 0x40, 0x30, 0xA0, 0x01, 0xF0, 0x00, 0x10, 0x81, 0xD0, 0x80, 0xF0, 0x00, 0x0C, 0x92, 0xD0, 0x80,
-  0xF0, 0x00, 0x0C, 0x94, 0xD0, 0x80, 0xA0, 0x10, 0x70, 0x00, 0x31, 0x7C, 0xA6, 0x50, 0x7C, 0x4D, 0x20, 0x83, 0x80, 0x09, 0x21, 0xF8, 0xF0, 0x00,
-  0xA0, 0xD0, 0x70, 0x00, 0x18, 0x41, 0xA6, 0x53, 0x15, 0x36, 0xD0, 0x80, 0xF0, 0x00, 0x0B, 0xC9, 0x60, 0x08, 0xF0, 0x00, 0x1D, 0x8D, 0xD2, 0x80,
-  0xF0, 0x00, 0x16, 0xD5, 0xD0, 0x80, 0xF0, 0x00, 0x0B, 0xC9, 0x60, 0x08, 0xF0, 0x00, 0x1D, 0x8F, 0xD2, 0x80, 0xF0, 0x00, 0x16, 0xDA, 0xD0, 0x80,
-  0x3E, 0x91, 0x1F, 0x5F, 0xD2, 0x80, 0xF0, 0x00, 0x23, 0x8A, 0xD0, 0x80, 0x0D, 0x85, 0x60, 0x08, 0xA2, 0x1B, 0xF0, 0x00, 0x30, 0x00, 0xD0, 0x08,
-  0xF0, 0x00, 0x0F, 0x88, 0x60, 0x0B, 0xF0, 0x00, 0x02, 0x30, 0x60, 0x03, 0xF0, 0x00, 0x09, 0x38, 0x60, 0x04, 0x9F, 0x98, 0x01, 0x2C, 0x60, 0x05,
-  0xF0, 0x00, 0x2E, 0xB3, 0xEE, 0x00, 0xF0, 0x00, 0x0F, 0xB1, 0xD2, 0x80, 0x9E, 0x09, 0x0D, 0x87, 0x60, 0x0C, 0x9F, 0x90, 0x70, 0x00, 0x90, 0x02,
-  0x9F, 0x88, 0x2F, 0x34, 0xEE, 0x00, 0xF0, 0x00, 0x2F, 0xB5, 0xEE, 0x00, 0x30, 0x43, 0x0B, 0x42, 0x60, 0x08, 0xF0, 0x00, 0x30, 0xC4, 0xF0, 0x00,
-  0xF0, 0x00, 0x31, 0x45, 0xF0, 0x00, 0xF0, 0x00, 0x2C, 0xB1, 0x40, 0x17, 0xF0, 0x00, 0x2D, 0x32, 0xF0, 0x00, 0xC6, 0x79, 0x22, 0x05, 0xF0, 0x00,
-  0xF0, 0x00, 0x3D, 0x81, 0xF0, 0x00, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xDD, 0x6D, 0x1B, 0x93, 0xD2, 0x80, 0x90, 0x46, 0x0D, 0x85, 0x60, 0x0A,
-  0x20, 0x42, 0x1B, 0x93, 0xD2, 0x80, 0xDA, 0xC9, 0x20, 0x25, 0xA2, 0x04, 0x8C, 0x69, 0x2D, 0xB3, 0xF0, 0x00, 0xDD, 0x49, 0x32, 0x01, 0xF0, 0x00,
-  0x8D, 0x89, 0x70, 0x00, 0xF0, 0x00, 0x3C, 0x81, 0xFE, 0x35, 0x60, 0x00, 0x35, 0x81, 0x00, 0x16, 0x60, 0x01, 0xA0, 0x18, 0x21, 0x46, 0xF0, 0x00,
-  0xAA, 0x07, 0x01, 0x2D, 0x60, 0x00, 0x81, 0xCF, 0x70, 0x00, 0xF0, 0x00, 0x8F, 0x80, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x94, 0x02,
-  0x40, 0x45, 0x57, 0x4B, 0x60, 0x00, 0xE0, 0x00, 0x60, 0x01, 0x80, 0x02, 0x40, 0x65, 0x40, 0x00, 0x60, 0x00, 0xC6, 0x66, 0x60, 0x01, 0x80, 0x00,
-  0xA0, 0x30, 0x40, 0x00, 0x60, 0x04, 0xAF, 0x4E, 0x00, 0xA4, 0x60, 0x05, 0x81, 0x8E, 0x0B, 0x75, 0x60, 0x08, 0xF0, 0x00, 0x14, 0x74, 0xD2, 0x80,
-  0xF0, 0x00, 0x1B, 0x90, 0xD2, 0x80, 0x2E, 0x34, 0x04, 0x00, 0x60, 0x06, 0x20, 0xC2, 0x1B, 0x93, 0xD2, 0x80, 0xD2, 0xC9, 0x03, 0xE9, 0x60, 0x05,
-  0x81, 0x8E, 0x0B, 0x59, 0x60, 0x08, 0x8F, 0x2D, 0x31, 0xC6, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x94, 0x02, 0x40, 0x45, 0xB1, 0x5C, 0x60, 0x03,
-  0x46, 0x66, 0x60, 0x07, 0x80, 0x02, 0x40, 0x65, 0xAA, 0xCE, 0x60, 0x03, 0xC6, 0x66, 0x60, 0x07, 0x80, 0x00, 0xA0, 0xE0, 0x00, 0x38, 0x60, 0x04,
-  0xAF, 0x48, 0x00, 0x1D, 0x60, 0x05, 0x81, 0xC7, 0x31, 0x84, 0xF0, 0x00, 0x31, 0x05, 0x14, 0x74, 0xD2, 0x80, 0xF0, 0x00, 0x1B, 0x90, 0xD2, 0x80,
-  0xF0, 0x00, 0xD8, 0x00, 0x60, 0x00, 0xF0, 0x00, 0x0B, 0x67, 0x60, 0x08, 0x21, 0xC6, 0x20, 0x00, 0x60, 0x04, 0xF0, 0x00, 0x13, 0x33, 0x60, 0x05,
-  0x81, 0x86, 0x31, 0x84, 0x40, 0x07, 0x31, 0x05, 0x14, 0x74, 0xD2, 0x80, 0xF0, 0x00, 0x1B, 0x90, 0xD0, 0x80, 0xF0, 0x00, 0x6E, 0x6C, 0x60, 0x03,
-  0x40, 0x07, 0x00, 0xE5, 0x60, 0x05, 0xA0, 0x58, 0xFF, 0xFF, 0x60, 0x03, 0xAA, 0x24, 0x0B, 0x52, 0x60, 0x08, 0x81, 0x1C, 0x70, 0x00, 0xF0, 0x00,
-  0x31, 0x05, 0x7F, 0xDF, 0x60, 0x06, 0x31, 0x84, 0x14, 0x74, 0xD2, 0x80, 0xF0, 0x00, 0x1B, 0x90, 0xD0, 0x80, 0x91, 0x83, 0x2E, 0x85, 0xF0, 0x00,
-  0xF0, 0x00, 0x2F, 0x06, 0xF0, 0x00, 0xF0, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x0B, 0xC9, 0x60, 0x09, 0xA1, 0xCF, 0x3E, 0x11, 0x0D, 0x82, 0x60, 0x0A,
-  0xF0, 0x00, 0x27, 0x11, 0xA1, 0xCD, 0xA0, 0x50, 0x27, 0x92, 0xF0, 0x00, 0xAA, 0x41, 0x0B, 0xB4, 0x60, 0x0C, 0x80, 0x52, 0x20, 0x21, 0xA1, 0xCA,
-  0x9E, 0xCB, 0x35, 0x92, 0xF0, 0x00, 0x90, 0x41, 0x70, 0x00, 0xD8, 0x09, 0x88, 0x2D, 0x70, 0x00, 0xD4, 0x09, 0xF0, 0x00, 0x36, 0x15, 0xF0, 0x00,
-  0xF0, 0x00, 0x36, 0x95, 0xF0, 0x00, 0x91, 0x00, 0x30, 0xA6, 0xF0, 0x00, 0x31, 0x27, 0x14, 0x62, 0xD2, 0x80, 0x90, 0x04, 0x31, 0xC0, 0xF0, 0x00,
-  0x21, 0x45, 0x8C, 0xCD, 0x60, 0x06, 0xF0, 0x00, 0xFF, 0x55, 0x60, 0x07, 0xF0, 0x00, 0x14, 0x74, 0xD2, 0x80, 0xF0, 0x00, 0x32, 0x40, 0xF0, 0x00,
-  0xF0, 0x00, 0x32, 0xC1, 0xF0, 0x00, 0xF0, 0x00, 0x33, 0x42, 0x80, 0x00, 0xF0, 0x00, 0x0D, 0x82, 0x60, 0x09, 0xF0, 0x00, 0x0B, 0xC9, 0x60, 0x0A,
-  0xF0, 0x00, 0x20, 0x15, 0xA1, 0xB9, 0x91, 0x45, 0x7F, 0xEC, 0x60, 0x06, 0x40, 0x47, 0x70, 0x00, 0xD4, 0x09, 0x20, 0x90, 0x14, 0x47, 0xD2, 0x80,
-  0xF0, 0x00, 0x34, 0xA0, 0xF0, 0x00, 0x21, 0x10, 0x14, 0x47, 0xD2, 0x80, 0xF0, 0x00, 0x35, 0x20, 0xD0, 0x08, 0x0A, 0x3D, 0x60, 0x07, 0xA1, 0xB2,
-  0xA2, 0x79, 0x0B, 0xC9, 0x60, 0x09, 0xA2, 0xBA, 0x70, 0x00, 0xF0, 0x00, 0x90, 0xC0, 0x3B, 0x91, 0xF0, 0x00, 0x3B, 0x12, 0x14, 0x62, 0xD2, 0x80,
-  0xF0, 0x00, 0x3C, 0x10, 0xD0, 0x08, 0xF0, 0x00, 0x0B, 0x60, 0x60, 0x0E, 0xF0, 0x00, 0x00, 0x04, 0x60, 0x03, 0x40, 0xA7, 0x3F, 0xFC, 0x60, 0x04,
-  0x32, 0x63, 0x80, 0x08, 0x60, 0x05, 0x32, 0xE4, 0x19, 0x9A, 0x60, 0x06, 0x33, 0x65, 0x0D, 0x86, 0x60, 0x0F, 0x31, 0xE6, 0x70, 0x00, 0xF0, 0x00,
-  0x30, 0x77, 0x70, 0x00, 0xD0, 0x08, 0x0D, 0x82, 0x60, 0x0A, 0xA1, 0xA4, 0xF0, 0x00, 0x30, 0x20, 0xF0, 0x00, 0x00, 0xD2, 0x60, 0x01, 0x94, 0x0B,
-  0xF0, 0x00, 0x00, 0xD2, 0x60, 0x02, 0x00, 0xFA, 0x60, 0x03, 0xAF, 0xED, 0xF0, 0x00, 0xBE, 0x77, 0x60, 0x06, 0xF0, 0x00, 0x4B, 0x00, 0x60, 0x07,
-  0x37, 0x06, 0x00, 0x01, 0x60, 0x01, 0x37, 0x87, 0x03, 0xE8, 0x60, 0x02, 0xF0, 0x00, 0x03, 0x84, 0x60, 0x04, 0xF0, 0x00, 0x00, 0x01, 0x60, 0x05,
-  0xF0, 0x00, 0x00, 0x8C, 0x60, 0x06, 0xF0, 0x00, 0x0A, 0xF0, 0x60, 0x07, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xC7, 0xF0, 0x00, 0x0B, 0xB4, 0x60, 0x09,
-  0xF0, 0x00, 0x00, 0x11, 0x60, 0x05, 0xF0, 0x00, 0x00, 0x11, 0x60, 0x06, 0x3B, 0x05, 0x10, 0x00, 0x60, 0x07, 0x3B, 0x86, 0x00, 0x04, 0x60, 0x00,
-  0x3C, 0x07, 0xAD, 0x84, 0x60, 0x01, 0x32, 0x10, 0x01, 0xFD, 0x60, 0x02, 0x32, 0x91, 0x0B, 0x5E, 0x60, 0x03, 0x33, 0x12, 0x0C, 0x80, 0x60, 0x04,
-  0x31, 0x93, 0x00, 0xA0, 0x60, 0x05, 0x34, 0x84, 0xFF, 0xD0, 0x60, 0x06, 0x35, 0x05, 0xE3, 0x54, 0x60, 0x07, 0x36, 0x06, 0x34, 0x00, 0x60, 0x00,
-  0x36, 0x86, 0x00, 0x01, 0x60, 0x01, 0x37, 0x07, 0x03, 0xE8, 0x60, 0x02, 0x37, 0x80, 0x70, 0x00, 0x8F, 0xB7, 0x80, 0xE5, 0x7F, 0xFF, 0x60, 0x00,
-  0xCC, 0x0A, 0x70, 0x00, 0xF0, 0x00, 0x8E, 0xA9, 0x33, 0x70, 0xF0, 0x00, 0xAF, 0x20, 0x34, 0x70, 0xD4, 0x09, 0xAE, 0xE8, 0x70, 0x00, 0xF0, 0x00,
-  0xA8, 0x05, 0x00, 0x80, 0x60, 0x07, 0xA8, 0xF6, 0x33, 0x75, 0xF0, 0x00, 0xC3, 0x86, 0x70, 0x00, 0xF0, 0x00, 0x8F, 0x7F, 0x33, 0xF6, 0xF0, 0x00,
-  0xA8, 0x85, 0x1D, 0xE4, 0xD1, 0x80, 0xF0, 0x00, 0x34, 0x75, 0xD0, 0x08, 0x0D, 0x86, 0x60, 0x09, 0xA1, 0x7B, 0x20, 0x12, 0x1F, 0x32, 0xD2, 0x80,
-  0xF0, 0x00, 0x35, 0x82, 0xD0, 0x08, 0x90, 0x82, 0x0D, 0x86, 0x60, 0x09, 0x40, 0xA7, 0x40, 0x77, 0xE6, 0x40, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x30, 0x17, 0xD0, 0x08, 0x0B, 0xB4, 0x60, 0x08, 0xA1, 0x74, 0xF0, 0x00, 0x31, 0x82, 0xD0, 0x08, 0xF0, 0x00, 0x09, 0x61, 0x60, 0x08,
-  0xF0, 0x00, 0x09, 0xC9, 0x60, 0x09, 0xF0, 0x00, 0x21, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0x91, 0xA1, 0x6F, 0xA2, 0x08, 0x70, 0x00, 0xD0, 0x08,
-  0x00, 0xCF, 0x60, 0x02, 0xA0, 0x01, 0x01, 0x51, 0x60, 0x02, 0x80, 0x01, 0x0D, 0x8B, 0x60, 0x08, 0x80, 0x01, 0x0D, 0x8C, 0x60, 0x08, 0x80, 0x00,
-  0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x02, 0xD0, 0x08, 0x0F, 0xF2, 0x60, 0x09, 0xA1, 0x67, 0x20, 0x11, 0x0D, 0x8B, 0x60, 0x0A,
-  0xF0, 0x00, 0x2C, 0x92, 0xF0, 0x00, 0x90, 0x41, 0x20, 0x11, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x93, 0xFE, 0xF0, 0x00, 0x70, 0x00, 0xF2, 0x00,
-  0x31, 0x22, 0x20, 0x31, 0xD0, 0x80, 0x0D, 0x8B, 0x60, 0x08, 0xA0, 0x03, 0xF0, 0x00, 0x20, 0x22, 0xD0, 0x80, 0x0D, 0x8C, 0x60, 0x08, 0xA0, 0x01,
-  0xF0, 0x00, 0x20, 0x1E, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x20, 0x00, 0x0E, 0x69, 0x60, 0x08, 0xF0, 0x00, 0x01, 0xD0, 0x60, 0x01,
-  0xF0, 0x00, 0x30, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x01, 0xD0, 0x08, 0x83, 0x6D, 0x0C, 0x35, 0x60, 0x08, 0x40, 0x60, 0x3A, 0x4D, 0x60, 0x01,
-  0x41, 0xE2, 0x21, 0x96, 0x60, 0x03, 0x33, 0x00, 0x41, 0x44, 0xF0, 0x00, 0x33, 0x81, 0x70, 0x00, 0xF0, 0x00, 0x34, 0x02, 0x70, 0x00, 0xF0, 0x00,
-  0x34, 0x83, 0x0C, 0x29, 0x60, 0x09, 0x35, 0x04, 0x3A, 0x5B, 0x60, 0x00, 0x35, 0x85, 0x3A, 0x60, 0x60, 0x03, 0x30, 0x90, 0x70, 0x00, 0xF0, 0x00,
-  0x33, 0x93, 0x70, 0x00, 0x8F, 0xDF, 0xF0, 0x00, 0x70, 0x00, 0xAE, 0x6C, 0xF0, 0x00, 0x70, 0x00, 0x8E, 0x9F, 0xF0, 0x00, 0x70, 0x00, 0xAE, 0x98,
-  0xF0, 0x00, 0x0C, 0x51, 0xD2, 0x80, 0xF0, 0x00, 0x21, 0xA0, 0xD0, 0x80, 0xF0, 0x00, 0x05, 0x2E, 0xD2, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xA0, 0x0E,
-  0xF0, 0x00, 0x21, 0xB7, 0xD0, 0x80, 0xF0, 0x00, 0x1F, 0x32, 0xD2, 0x80, 0xF0, 0x00, 0x1E, 0x84, 0xD2, 0x80, 0xF0, 0x00, 0x21, 0xE0, 0xD0, 0x80,
-  0xF0, 0x00, 0x1E, 0xA4, 0xD2, 0x80, 0xF0, 0x00, 0x07, 0xF7, 0xD2, 0x80, 0xF0, 0x00, 0x22, 0x15, 0xD0, 0x80, 0xF0, 0x00, 0x07, 0xFB, 0xD2, 0x80,
-  0xF0, 0x00, 0x22, 0x8F, 0xD0, 0x80, 0x40, 0x40, 0x22, 0xE1, 0xD2, 0x80, 0x40, 0x80, 0x22, 0xE2, 0xD2, 0x80, 0xF0, 0x00, 0x22, 0x9C, 0xD0, 0x80,
-  0xF0, 0x00, 0x07, 0xFB, 0xD2, 0x80, 0xF0, 0x00, 0x22, 0xB6, 0xD0, 0x80, 0xF0, 0x00, 0x20, 0xF0, 0xD2, 0x80, 0x90, 0x02, 0x27, 0xDF, 0xD2, 0x80,
-  0x9E, 0x69, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0x00, 0xD1, 0x80, 0xF0, 0x00, 0x23, 0x20, 0xD0, 0x80, 0x90, 0x82, 0x0C, 0x29, 0x60, 0x09,
-  0x40, 0x17, 0x40, 0x67, 0xE6, 0x40, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x32, 0x17, 0xD0, 0x08, 0xF0, 0x00, 0x07, 0xF7, 0xD2, 0x80,
-  0xF0, 0x00, 0x27, 0xEA, 0xD2, 0x80, 0xF0, 0x00, 0x11, 0xB5, 0xD0, 0x80, 0x40, 0x55, 0x15, 0x17, 0x60, 0x08, 0xF0, 0x00, 0x1D, 0x40, 0x60, 0x00,
-  0x31, 0x05, 0x1E, 0x60, 0x60, 0x01, 0x31, 0x85, 0x70, 0x00, 0xF0, 0x00, 0x32, 0x05, 0x70, 0x00, 0xF0, 0x00, 0x32, 0x85, 0x70, 0x00, 0xF0, 0x00,
-  0x33, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x33, 0x81, 0x0D, 0x8E, 0x60, 0x09, 0x34, 0x00, 0x02, 0x54, 0x60, 0x02, 0x34, 0x81, 0x38, 0x80, 0x60, 0x03,
-  0x30, 0x12, 0x70, 0x00, 0xF0, 0x00, 0x30, 0x93, 0x70, 0x00, 0xD0, 0x08, 0x17, 0x0B, 0x60, 0x0C, 0xA1, 0x1F, 0x00, 0x40, 0x40, 0x05, 0xF0, 0x00,
-  0x00, 0x41, 0x24, 0x3F, 0xD0, 0x80, 0xF0, 0x00, 0x0C, 0x83, 0x60, 0x08, 0x90, 0x00, 0x0C, 0x6B, 0x60, 0x0B, 0xF0, 0x00, 0x70, 0x0C, 0xE6, 0x00,
-  0xF0, 0x00, 0x20, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x22, 0x04, 0xF0, 0x00, 0xF0, 0x00, 0x3B, 0xB3, 0xF0, 0x00, 0xF0, 0x00, 0x3C, 0x34, 0xD0, 0x08,
-  0xF0, 0x00, 0x70, 0x00, 0xAD, 0xC8, 0xF0, 0x00, 0x0C, 0x8D, 0x60, 0x08, 0xF0, 0x00, 0x26, 0x0A, 0xD0, 0x80, 0x83, 0xFF, 0x0D, 0x9B, 0x60, 0x08,
-  0xF0, 0x00, 0x01, 0xF4, 0x60, 0x00, 0xF0, 0x00, 0x03, 0xB1, 0x60, 0x01, 0x10, 0x00, 0x03, 0xB2, 0x60, 0x02, 0x10, 0x01, 0x04, 0x0E, 0x60, 0x00,
-  0x10, 0x02, 0x04, 0x0F, 0x60, 0x01, 0x10, 0x00, 0x04, 0x5C, 0x60, 0x02, 0x10, 0x01, 0x04, 0x5D, 0x60, 0x00, 0x10, 0x02, 0x13, 0x80, 0x60, 0x01,
-  0x10, 0x00, 0x0D, 0xAB, 0x60, 0x09, 0x10, 0x01, 0x02, 0xEE, 0x60, 0x00, 0x10, 0x07, 0x43, 0x06, 0x60, 0x01, 0x10, 0x10, 0x04, 0x69, 0x60, 0x02,
-  0x10, 0x11, 0x44, 0x87, 0x60, 0x00, 0x10, 0x12, 0x05, 0xE3, 0x60, 0x01, 0x10, 0x10, 0x46, 0x08, 0x60, 0x02, 0x10, 0x11, 0x06, 0xAE, 0x60, 0x00,
-  0x10, 0x12, 0x0D, 0xA4, 0x60, 0x08, 0x10, 0x10, 0x9E, 0x3C, 0x60, 0x00, 0x10, 0x17, 0x0D, 0xB3, 0x60, 0x09, 0x10, 0x00, 0x25, 0xDA, 0x60, 0x00,
-  0x10, 0x07, 0x80, 0x3D, 0x60, 0x01, 0x10, 0x10, 0x28, 0x82, 0x60, 0x02, 0x10, 0x11, 0xC0, 0x3D, 0x60, 0x00, 0x10, 0x12, 0x28, 0x87, 0x60, 0x01,
-  0x10, 0x10, 0xC0, 0x3B, 0x60, 0x02, 0x10, 0x11, 0x28, 0x8C, 0x60, 0x00, 0x10, 0x12, 0xC0, 0x3B, 0x60, 0x01, 0x10, 0x10, 0x28, 0x91, 0x60, 0x02,
-  0x10, 0x11, 0xC0, 0x3B, 0x60, 0x00, 0x10, 0x12, 0x28, 0x96, 0x60, 0x01, 0x10, 0x10, 0xC0, 0x3B, 0x60, 0x02, 0x10, 0x11, 0x28, 0x9B, 0x60, 0x00,
-  0x10, 0x12, 0xC0, 0x3B, 0x60, 0x01, 0x10, 0x10, 0x28, 0xA0, 0x60, 0x02, 0x10, 0x11, 0x40, 0x3C, 0x60, 0x00, 0x10, 0x12, 0x28, 0xA5, 0x60, 0x01,
-  0x10, 0x10, 0xC0, 0x3C, 0x60, 0x02, 0x10, 0x11, 0x28, 0xAA, 0x60, 0x00, 0x10, 0x12, 0xC0, 0x3C, 0x60, 0x01, 0x10, 0x10, 0x28, 0xAF, 0x60, 0x02,
-  0x10, 0x11, 0xC0, 0x3C, 0x60, 0x00, 0x10, 0x12, 0x28, 0xB4, 0x60, 0x01, 0x10, 0x10, 0xC0, 0x3C, 0x60, 0x02, 0x10, 0x11, 0x28, 0xB9, 0x60, 0x00,
-  0x10, 0x12, 0xC0, 0x3C, 0x60, 0x01, 0x10, 0x10, 0x28, 0xBE, 0x60, 0x02, 0x10, 0x11, 0xC0, 0x3C, 0x60, 0x00, 0x10, 0x12, 0x29, 0xCC, 0x60, 0x01,
-  0x10, 0x10, 0x00, 0x37, 0x60, 0x02, 0x10, 0x11, 0x29, 0xD1, 0x60, 0x00, 0x10, 0x12, 0x00, 0x37, 0x60, 0x01, 0x10, 0x10, 0x29, 0xD6, 0x60, 0x02,
-  0x10, 0x11, 0x00, 0x37, 0x60, 0x00, 0x10, 0x12, 0x29, 0xDB, 0x60, 0x01, 0x10, 0x10, 0x00, 0x37, 0x60, 0x02, 0x10, 0x11, 0x0D, 0xD8, 0x60, 0x08,
-  0x10, 0x12, 0x27, 0x15, 0x60, 0x00, 0x10, 0x17, 0x40, 0x3E, 0x60, 0x01, 0x10, 0x00, 0x27, 0x1A, 0x60, 0x02, 0x10, 0x01, 0x80, 0x3C, 0x60, 0x00,
-  0x10, 0x02, 0x28, 0x64, 0x60, 0x01, 0x10, 0x00, 0x40, 0x3C, 0x60, 0x02, 0x10, 0x01, 0x28, 0x69, 0x60, 0x00, 0x10, 0x02, 0x40, 0x3C, 0x60, 0x01,
-  0x10, 0x00, 0x28, 0x6E, 0x60, 0x02, 0x10, 0x01, 0x80, 0x3A, 0x60, 0x00, 0x10, 0x02, 0x28, 0x73, 0x60, 0x01, 0x10, 0x00, 0x80, 0x3A, 0x60, 0x02,
-  0x10, 0x01, 0x28, 0xA0, 0x60, 0x00, 0x10, 0x02, 0x40, 0x3C, 0x60, 0x01, 0x10, 0x00, 0x29, 0xCC, 0x60, 0x02, 0x10, 0x01, 0x00, 0x37, 0x60, 0x00,
-  0x10, 0x02, 0x29, 0xD1, 0x60, 0x01, 0x10, 0x00, 0x00, 0x37, 0x60, 0x02, 0x10, 0x01, 0x29, 0xD6, 0x60, 0x00, 0x10, 0x02, 0x00, 0x37, 0x60, 0x01,
-  0x10, 0x00, 0x29, 0xDB, 0x60, 0x02, 0x10, 0x01, 0x00, 0x37, 0x60, 0x00, 0x10, 0x02, 0x0D, 0xEF, 0x60, 0x09, 0x10, 0x00, 0x70, 0x00, 0xF0, 0x00,
-  0x10, 0x07, 0x70, 0x00, 0xF0, 0x00, 0x10, 0x17, 0x70, 0x00, 0xD0, 0x08, 0x0C, 0xDF, 0x60, 0x0B, 0xA0, 0xBF, 0x30, 0x30, 0x23, 0xD6, 0xD2, 0x80,
-  0xF0, 0x00, 0x26, 0xE8, 0xD0, 0x80, 0x0D, 0x9B, 0x60, 0x08, 0xA0, 0xBC, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0xBB, 0x90, 0x82, 0x70, 0x00, 0xF0, 0x00,
-  0x82, 0x8A, 0x70, 0x00, 0x90, 0x03, 0x90, 0x8A, 0x70, 0x00, 0x90, 0x01, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xFB, 0x82, 0xBF, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x01, 0x99, 0xD2, 0x80, 0xF0, 0x00, 0x0D, 0x9A, 0x60, 0x08, 0xF0, 0x00, 0x26, 0xC1, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0xB2,
-  0x90, 0x82, 0x70, 0x00, 0xF0, 0x00, 0x82, 0x8A, 0x70, 0x00, 0x90, 0x03, 0x90, 0x8A, 0x70, 0x00, 0x90, 0x01, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xFB,
-  0x82, 0x80, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x0D, 0xAB, 0x60, 0x0D, 0xF0, 0x00, 0x3F, 0xFF, 0x60, 0x02,
-  0xF0, 0x00, 0x00, 0x51, 0xA0, 0xA9, 0xC2, 0x53, 0x70, 0x00, 0xF0, 0x00, 0x8E, 0xC4, 0x70, 0x00, 0x90, 0x01, 0xF0, 0x00, 0x70, 0x00, 0x97, 0xFC,
-  0xD4, 0x8F, 0x01, 0x99, 0xD2, 0x80, 0x40, 0x05, 0x0D, 0xA4, 0x60, 0x0D, 0x40, 0x17, 0x3F, 0xFF, 0x60, 0x02, 0x9F, 0x7D, 0x00, 0x51, 0xA0, 0xA2,
-  0xC2, 0x53, 0x70, 0x00, 0xF0, 0x00, 0x82, 0xC4, 0x27, 0x1C, 0xD1, 0x80, 0xF0, 0x00, 0x70, 0x00, 0x97, 0xFC, 0x91, 0x46, 0x27, 0x20, 0xD0, 0x80,
-  0x40, 0x07, 0x01, 0x99, 0xD2, 0x80, 0xF0, 0x00, 0x0D, 0x8E, 0x60, 0x0E, 0x40, 0x07, 0x25, 0xC1, 0xA0, 0x9B, 0x9E, 0x79, 0x2E, 0x40, 0x40, 0x14,
-  0x40, 0x36, 0x31, 0x67, 0x90, 0x19, 0x2F, 0x45, 0x19, 0x64, 0x60, 0x02, 0x4F, 0xF0, 0x1A, 0x5E, 0x60, 0x03, 0x83, 0x54, 0x40, 0x36, 0xF0, 0x00,
-  0x83, 0x5C, 0x40, 0x00, 0xE2, 0x00, 0xF0, 0x00, 0x40, 0x10, 0xE2, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x90, 0x00, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x70, 0x00, 0x9C, 0x11, 0xF0, 0x00, 0x0D, 0xD8, 0x60, 0x0D, 0x40, 0x36, 0x22, 0xF0, 0xD2, 0x80, 0x0D, 0xB3, 0x60, 0x0D, 0xE6, 0x00,
-  0x40, 0x14, 0x21, 0x40, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0x51, 0xA0, 0x8C, 0x90, 0x41, 0x70, 0x00, 0xF0, 0x00, 0x82, 0x45, 0x70, 0x00, 0x90, 0x1D,
-  0xF0, 0x00, 0x70, 0x00, 0x90, 0x01, 0xF0, 0x00, 0x70, 0xDC, 0x8F, 0xFB, 0x20, 0xD1, 0x3F, 0xFF, 0x60, 0x02, 0xF0, 0x00, 0x0C, 0xDF, 0x60, 0x0B,
-  0xC2, 0x53, 0x31, 0x61, 0xF0, 0x00, 0xD4, 0x8E, 0x30, 0x33, 0xF0, 0x00, 0xD4, 0x4A, 0x37, 0xC6, 0xF0, 0x00, 0xC6, 0xA2, 0x70, 0x00, 0xF0, 0x00,
-  0xC3, 0xA0, 0x3D, 0x42, 0xF0, 0x00, 0xF0, 0x00, 0x31, 0xE0, 0xD0, 0x08, 0xC6, 0x24, 0x31, 0xE0, 0xF0, 0x00, 0x90, 0x00, 0x3D, 0x44, 0xF0, 0x00,
-  0x83, 0xB6, 0x70, 0x00, 0xE0, 0x40, 0x40, 0xD5, 0x21, 0x41, 0xA0, 0x7C, 0xCC, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x80, 0xED, 0x23, 0xEA, 0xD2, 0x80,
-  0xBF, 0x60, 0x20, 0x60, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0xE1, 0xF0, 0x00, 0xF0, 0x00, 0x23, 0xEA, 0xD2, 0x80, 0x90, 0xC6, 0x23, 0xDE, 0xD2, 0x80,
-  0x4F, 0x95, 0x40, 0x14, 0xA0, 0x75, 0x81, 0x75, 0x70, 0x00, 0xF0, 0x00, 0xAF, 0x43, 0x70, 0x00, 0xF0, 0x00, 0xC2, 0xE0, 0x70, 0x00, 0xF0, 0x00,
-  0x80, 0xC3, 0x0C, 0xDF, 0x60, 0x0B, 0xF0, 0x00, 0x33, 0x63, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0xE3, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0x33, 0xA0, 0x41,
-  0xF0, 0x00, 0x70, 0x00, 0x80, 0x12, 0x40, 0xD5, 0x21, 0x41, 0xA0, 0x6C, 0xCC, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x80, 0xED, 0x23, 0xEA, 0xD2, 0x80,
-  0xBF, 0x60, 0x20, 0x60, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0xE1, 0xF0, 0x00, 0xF0, 0x00, 0x23, 0xEA, 0xD2, 0x80, 0x90, 0xC6, 0x23, 0xDE, 0xD2, 0x80,
-  0x4F, 0x95, 0x40, 0x14, 0xA0, 0x65, 0x81, 0x75, 0x70, 0x00, 0x40, 0x06, 0xAF, 0x43, 0x70, 0x00, 0xF0, 0x00, 0xC2, 0xE0, 0x0C, 0xDF, 0x60, 0x0B,
-  0xF0, 0x00, 0x31, 0xE0, 0xF0, 0x00, 0x80, 0xC3, 0x40, 0x36, 0xE6, 0x00, 0xC6, 0x24, 0x30, 0x33, 0xF0, 0x00, 0xF0, 0x00, 0x33, 0x63, 0xF0, 0x00,
-  0xF0, 0x00, 0x34, 0xE3, 0xF0, 0x00, 0xF0, 0x00, 0x3D, 0x44, 0xF0, 0x00, 0xF0, 0x00, 0x37, 0xC6, 0xA0, 0x2E, 0xF0, 0x00, 0x23, 0x66, 0xA0, 0x31,
-  0x82, 0x92, 0x0B, 0xB8, 0x60, 0x03, 0x47, 0xF4, 0x23, 0xE0, 0xD2, 0x80, 0x52, 0x08, 0x60, 0x05, 0x98, 0x03, 0x82, 0x92, 0x52, 0x08, 0x60, 0x03,
-  0x47, 0xF4, 0x23, 0xE0, 0xD2, 0x80, 0x52, 0x08, 0x60, 0x05, 0x98, 0x23, 0xF0, 0x00, 0x33, 0xE4, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0x65, 0xF0, 0x00,
-  0xF0, 0x00, 0x35, 0x64, 0xF0, 0x00, 0xF0, 0x00, 0x35, 0xE5, 0xF0, 0x00, 0xF0, 0x00, 0x23, 0x66, 0xA0, 0x4F, 0x91, 0x8E, 0x70, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x33, 0x66, 0xA0, 0x24, 0x82, 0x92, 0x52, 0x08, 0x60, 0x03, 0xF0, 0x00, 0x23, 0xE0, 0xD2, 0x80, 0xF0, 0x00, 0x70, 0x00, 0x9C, 0x05,
-  0x82, 0x92, 0x0B, 0xB8, 0x60, 0x03, 0xF0, 0x00, 0x23, 0xE0, 0xD2, 0x80, 0xF0, 0x00, 0x70, 0x00, 0x9B, 0xF7, 0x0D, 0x94, 0x60, 0x0D, 0xA0, 0x2B,
-  0xF0, 0x00, 0x70, 0x00, 0x8F, 0xF5, 0xF0, 0x00, 0x24, 0xE6, 0xA0, 0x44, 0x9F, 0xBE, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x34, 0xE6, 0xA0, 0x19,
-  0x82, 0x92, 0x52, 0x08, 0x60, 0x03, 0xF0, 0x00, 0x23, 0xE0, 0xD2, 0x80, 0xF0, 0x00, 0x70, 0x00, 0x9C, 0x05, 0x82, 0x92, 0x0B, 0xB8, 0x60, 0x03,
-  0xF0, 0x00, 0x23, 0xE0, 0xD2, 0x80, 0xF0, 0x00, 0x70, 0x00, 0x9B, 0xF7, 0x0D, 0x97, 0x60, 0x0D, 0xA0, 0x20, 0xF0, 0x00, 0x70, 0x00, 0x8F, 0xF5,
-  0x40, 0x14, 0x23, 0xE1, 0xA0, 0x39, 0xC2, 0x63, 0x25, 0x62, 0xF0, 0x00, 0xF0, 0x00, 0x24, 0x65, 0x90, 0x07, 0xC2, 0xA3, 0x25, 0xE6, 0xF0, 0x00,
-  0x90, 0x80, 0x70, 0x00, 0x90, 0x02, 0x83, 0x77, 0x70, 0x00, 0xF0, 0x00, 0x25, 0x60, 0x23, 0xE0, 0xEB, 0xC0, 0x0C, 0xDF, 0x60, 0x0B, 0xA0, 0x32,
-  0xF0, 0x00, 0x30, 0x30, 0xF0, 0x00, 0xF0, 0x00, 0x21, 0xE0, 0xD0, 0x08, 0xC2, 0xA3, 0x25, 0xE6, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x93, 0xF9,
-  0x90, 0x40, 0x70, 0x00, 0x8F, 0xFA, 0xF0, 0x00, 0x21, 0xE0, 0xAF, 0x0F, 0xF0, 0x00, 0x24, 0x62, 0xD2, 0x80, 0xF0, 0x00, 0x32, 0x60, 0xF0, 0x00,
-  0xF0, 0x00, 0x32, 0xE1, 0xD0, 0x08, 0xF0, 0x00, 0x23, 0xED, 0xD2, 0x80, 0xB8, 0x68, 0x22, 0x60, 0xF0, 0x00, 0xF0, 0x00, 0x22, 0xE1, 0xF0, 0x00,
-  0xF0, 0x00, 0x23, 0xEA, 0xD2, 0x80, 0xF0, 0x00, 0x23, 0xDE, 0xD2, 0x80, 0xA9, 0x88, 0x70, 0x00, 0xF0, 0x00, 0xAB, 0xF8, 0x23, 0xE4, 0xD2, 0x80,
-  0x46, 0x43, 0x21, 0x42, 0xA0, 0x21, 0xA0, 0x98, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x23, 0xE7, 0xD2, 0x80, 0xF0, 0x00, 0x23, 0xC6, 0xD2, 0x80,
-  0x90, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xDC, 0x09, 0xF0, 0x00, 0x23, 0xCE, 0xD0, 0x80, 0x47, 0xE5, 0x70, 0x00, 0xF0, 0x00,
-  0x40, 0x16, 0x20, 0xD3, 0xA0, 0x19, 0x83, 0x5D, 0x20, 0x52, 0xF0, 0x00, 0xC2, 0xF5, 0x21, 0x54, 0x98, 0x07, 0xC2, 0xB6, 0x70, 0x00, 0x90, 0x02,
-  0xF0, 0x00, 0x70, 0x00, 0x90, 0x05, 0xF0, 0x00, 0x70, 0x00, 0x80, 0x02, 0xC2, 0xB6, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xD4, 0x09,
-  0x82, 0x64, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xDC, 0x09, 0xF0, 0x00, 0x31, 0x51, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0xD2, 0xD0, 0x08,
-  0x0D, 0xEF, 0x60, 0x0B, 0xA0, 0x0D, 0x9E, 0x79, 0x20, 0x36, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0x45, 0xF0, 0x00, 0x9F, 0xBC, 0x70, 0x00, 0xE0, 0x40,
-  0x91, 0x45, 0x70, 0x00, 0xD0, 0x09, 0x26, 0x44, 0x27, 0x2D, 0xD5, 0x80, 0x91, 0x86, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x27, 0x32, 0xD5, 0x80,
-  0xF0, 0x00, 0x70, 0x00, 0xAF, 0x67, 0x2F, 0x41, 0x27, 0x36, 0xD0, 0x80, 0xF0, 0x00, 0x29, 0x15, 0xD2, 0x80, 0xF0, 0x00, 0x3B, 0x9B, 0xD2, 0x80,
-  0xF0, 0x00, 0x28, 0x88, 0xD0, 0x80, 0xF0, 0x00, 0x28, 0xDD, 0xD0, 0x80, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08, 0xF0, 0x00, 0x16, 0xC3, 0x60, 0x08,
-  0xF0, 0x00, 0x00, 0x9A, 0x60, 0x00, 0xF0, 0x00, 0x02, 0xE3, 0x60, 0x00, 0x10, 0x00, 0x04, 0xF4, 0x60, 0x00, 0x10, 0x00, 0x06, 0xFF, 0x60, 0x00,
-  0x10, 0x00, 0x09, 0x07, 0x60, 0x00, 0x10, 0x00, 0x0B, 0x10, 0x60, 0x00, 0x10, 0x00, 0x0D, 0x1F, 0x60, 0x00, 0x10, 0x00, 0x0F, 0x65, 0x60, 0x00,
-  0x10, 0x00, 0x0F, 0x65, 0x60, 0x00, 0x10, 0x00, 0x0D, 0x1F, 0x60, 0x00, 0x10, 0x00, 0x0B, 0x10, 0x60, 0x00, 0x10, 0x00, 0x09, 0x07, 0x60, 0x00,
-  0x10, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x10, 0x00, 0x04, 0xF4, 0x60, 0x00, 0x10, 0x00, 0x02, 0xE3, 0x60, 0x00, 0x10, 0x00, 0x00, 0x9A, 0x60, 0x00,
-  0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x16, 0xD3, 0x60, 0x08, 0xF0, 0x00, 0xFF, 0x93, 0x60, 0x00,
-  0xF0, 0x00, 0xFE, 0x37, 0x60, 0x00, 0x10, 0x00, 0xFD, 0xD9, 0x60, 0x00, 0x10, 0x00, 0xFE, 0x9F, 0x60, 0x00, 0x10, 0x00, 0x03, 0x85, 0x60, 0x00,
-  0x10, 0x00, 0x0D, 0x6B, 0x60, 0x00, 0x10, 0x00, 0x16, 0x84, 0x60, 0x00, 0x10, 0x00, 0x1E, 0x49, 0x60, 0x00, 0x10, 0x00, 0x1E, 0x49, 0x60, 0x00,
-  0x10, 0x00, 0x16, 0x84, 0x60, 0x00, 0x10, 0x00, 0x0D, 0x6B, 0x60, 0x00, 0x10, 0x00, 0x03, 0x85, 0x60, 0x00, 0x10, 0x00, 0xFE, 0x9F, 0x60, 0x00,
-  0x10, 0x00, 0xFD, 0xD9, 0x60, 0x00, 0x10, 0x00, 0xFE, 0x37, 0x60, 0x00, 0x10, 0x00, 0xFF, 0x93, 0x60, 0x00, 0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x16, 0xE3, 0x60, 0x08, 0xF0, 0x00, 0x00, 0x64, 0x60, 0x00, 0xF0, 0x00, 0xFF, 0xA8, 0x60, 0x00,
-  0x10, 0x00, 0xFF, 0xA6, 0x60, 0x00, 0x10, 0x00, 0xFF, 0xDF, 0x60, 0x00, 0x10, 0x00, 0x00, 0x01, 0x60, 0x00, 0x10, 0x00, 0x01, 0x28, 0x60, 0x00,
-  0x10, 0x00, 0x01, 0x2F, 0x60, 0x00, 0x10, 0x00, 0xFD, 0x23, 0x60, 0x00, 0x10, 0x00, 0xFD, 0xA1, 0x60, 0x00, 0x10, 0x00, 0x03, 0x89, 0x60, 0x00,
-  0x10, 0x00, 0x02, 0x54, 0x60, 0x00, 0x10, 0x00, 0xFE, 0x7D, 0x60, 0x00, 0x10, 0x00, 0x00, 0x8C, 0x60, 0x00, 0x10, 0x00, 0xFB, 0xE1, 0x60, 0x00,
-  0x10, 0x00, 0xF9, 0x42, 0x60, 0x00, 0x10, 0x00, 0x0C, 0x47, 0x60, 0x00, 0x10, 0x00, 0x0E, 0xA2, 0x60, 0x00, 0x10, 0x00, 0xEC, 0x43, 0x60, 0x00,
-  0x10, 0x00, 0xEA, 0xCE, 0x60, 0x00, 0x10, 0x00, 0x17, 0x46, 0x60, 0x00, 0x10, 0x00, 0x17, 0x46, 0x60, 0x00, 0x10, 0x00, 0xEA, 0xCE, 0x60, 0x00,
-  0x10, 0x00, 0xEC, 0x43, 0x60, 0x00, 0x10, 0x00, 0x0E, 0xA2, 0x60, 0x00, 0x10, 0x00, 0x0C, 0x47, 0x60, 0x00, 0x10, 0x00, 0xF9, 0x42, 0x60, 0x00,
-  0x10, 0x00, 0xFB, 0xE1, 0x60, 0x00, 0x10, 0x00, 0x00, 0x8C, 0x60, 0x00, 0x10, 0x00, 0xFE, 0x7D, 0x60, 0x00, 0x10, 0x00, 0x02, 0x54, 0x60, 0x00,
-  0x10, 0x00, 0x03, 0x89, 0x60, 0x00, 0x10, 0x00, 0xFD, 0xA1, 0x60, 0x00, 0x10, 0x00, 0xFD, 0x23, 0x60, 0x00, 0x10, 0x00, 0x01, 0x2F, 0x60, 0x00,
-  0x10, 0x00, 0x01, 0x28, 0x60, 0x00, 0x10, 0x00, 0x00, 0x01, 0x60, 0x00, 0x10, 0x00, 0xFF, 0xDF, 0x60, 0x00, 0x10, 0x00, 0xFF, 0xA6, 0x60, 0x00,
-  0x10, 0x00, 0xFF, 0xA8, 0x60, 0x00, 0x10, 0x00, 0x00, 0x64, 0x60, 0x00, 0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x17, 0x0B, 0x60, 0x08, 0xF0, 0x00, 0x00, 0x03, 0x60, 0x00, 0xF0, 0x00, 0x54, 0xC0, 0x60, 0x00, 0x10, 0x00, 0x00, 0x05, 0x60, 0x00,
-  0x10, 0x00, 0x00, 0x05, 0x60, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x10, 0x00, 0x09, 0xC0, 0x60, 0x00,
-  0x10, 0x00, 0x0A, 0x20, 0x60, 0x00, 0x10, 0x00, 0x1D, 0x40, 0x60, 0x00, 0x10, 0x00, 0x1E, 0x60, 0x60, 0x00, 0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00,
-  0xF0, 0x00, 0x10, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xD0, 0x08
+  0xBF, 0xF0, 0x00, 0x38, 0x3B, 0xD0, 0x80, 0x01, 0x40, 0x43, 0xBF, 0xD0, 0x80, 0x43, 0xB2, 0x38, 0x46, 0x02, 0xC1, 0x70, 0xD7, 0x00, 0xC2, 0xF7,
+  0x04, 0x40, 0x77, 0x05, 0xC2, 0x7B, 0xDF, 0xFF, 0x80, 0x80, 0xFC, 0x39, 0x0E, 0xD0, 0x80, 0xC2, 0xFF, 0x38, 0x20, 0x11, 0x40, 0xB7, 0x9F, 0xA7,
+  0x39, 0xB7, 0x13, 0xD2, 0x80, 0x01, 0x40, 0x1D, 0xD2, 0x07, 0x40, 0x39, 0xFD, 0x24, 0x08, 0xC1, 0x39, 0x27, 0xD0, 0x80, 0x90, 0x41, 0xB7, 0x39,
+  0x49, 0xDD, 0x02, 0xC0, 0x3A, 0x25, 0x04, 0x42, 0x4D, 0xFA, 0x01, 0x41, 0x3A, 0x05, 0xC0, 0xC4, 0xA2, 0x02, 0x18, 0x60, 0xD5, 0x04, 0x04, 0x40,
+  0xBF, 0x05, 0xC2, 0xE7, 0x0A, 0x40, 0x01, 0x39, 0x55, 0x4F, 0x16, 0x42, 0xF0, 0x04, 0x42, 0x56, 0x11, 0xC2, 0x5A, 0x1F, 0x40, 0xD7, 0x84, 0x39,
+  0x64, 0x04, 0x42, 0x67, 0x01, 0x42, 0x6B, 0xD0, 0xFF, 0x80, 0x78, 0x4D, 0x39, 0x71, 0xD0, 0x80, 0x9E, 0xD7, 0x30, 0x18, 0xF9, 0x08, 0xC2, 0x76,
+  0x05, 0xC2, 0x79, 0xD0, 0xDF, 0x80, 0x30, 0x77, 0x39, 0xDE, 0x02, 0xC2, 0x7C, 0xD0, 0x5F, 0x80, 0x32, 0x00, 0x39, 0x7E, 0x02, 0xC2, 0x80, 0x01,
+  0x42, 0xFD, 0xC7, 0x01, 0x42, 0xF5, 0xD0, 0x80, 0xA8, 0x01, 0x3A, 0x95, 0x13, 0x20, 0xC2, 0x32, 0x01, 0x42, 0x39, 0x01, 0x42, 0x3A, 0x42, 0x3A,
+  0x56, 0x1F, 0x42, 0x3A, 0x52, 0x01, 0x42, 0x55, 0x3B, 0xC3, 0xF0, 0x00, 0x40, 0xAB, 0x3A, 0x58, 0x02, 0xC8, 0x5D, 0x07, 0x42, 0x1E, 0x1D, 0xC1,
+  0x3A, 0xBE, 0x22, 0x40, 0x00, 0x43, 0x3A, 0x7A, 0xD9, 0x02, 0xC1, 0x84, 0xEA, 0x05, 0xC2, 0xDA, 0x01, 0x42, 0xDD, 0x01, 0x42, 0xEE, 0xD0, 0x80,
+  0x6F, 0x2E, 0x40, 0x3B, 0x8C, 0x02, 0xC1, 0x3B, 0x96, 0x01, 0x41, 0xFF, 0x0E, 0x3F, 0x60, 0x00, 0x50, 0x10, 0x28, 0xD8, 0x7F, 0xD2, 0x80, 0x91,
+  0x01, 0x01, 0x36, 0x60, 0x13, 0x40, 0xAF, 0x70, 0x00, 0xA0, 0x18, 0x01, 0x42, 0xCC, 0x01, 0x42, 0xED, 0xB6, 0x01, 0x41, 0xA1, 0xAE, 0x01, 0x41,
+  0xA2, 0x02, 0x01, 0x42, 0x2D, 0xBE, 0x01, 0x42, 0x45, 0xF0, 0x00, 0x20, 0x31, 0x10, 0x41, 0x04, 0x7F, 0xC1, 0x60, 0x08, 0xF0, 0x00, 0x01, 0x01,
+  0x1F, 0x41, 0x7B, 0x00, 0x30, 0x1F, 0x40, 0x7F, 0x60, 0x02, 0xE2, 0x11, 0xC0, 0xEF, 0x0E, 0x22, 0x60, 0x0A, 0x04, 0x40, 0xFF, 0x60, 0x03, 0x7E,
+  0x07, 0x40, 0x42, 0xD2, 0x80, 0x90, 0x03, 0x40, 0x0F, 0xC0, 0xDF, 0x90, 0x43, 0x01, 0x70, 0xD1, 0x0A, 0x40, 0x01, 0x69, 0xFF, 0xD0, 0x80, 0x0E,
+  0x69, 0x60, 0x0A, 0xA3, 0x4C, 0xBF, 0x20, 0x23, 0x00, 0x01, 0x60, 0x01, 0x32, 0xC3, 0xC4, 0xFD, 0xCB, 0x01, 0x41, 0xCA, 0x09, 0x30, 0x23, 0xF0,
+  0x00, 0xFD, 0xC2, 0x02, 0xC2, 0xF0, 0x00, 0x30, 0x23, 0xD0, 0x08, 0xEF, 0x82, 0x00, 0x0D, 0x50, 0x19, 0x41, 0x0D, 0x51, 0x60, 0xDF, 0x09, 0x30,
+  0x00, 0x21, 0x80, 0x0B, 0xC1, 0x40, 0x32, 0xEE, 0x06, 0xC0, 0x11, 0x45, 0xF3, 0x01, 0x40, 0x92, 0x2D, 0x30, 0xFF, 0x60, 0x04, 0x31, 0x13, 0x2D,
+  0x40, 0x60, 0x05, 0xFF, 0x31, 0x94, 0x7F, 0xFF, 0x60, 0x06, 0x32, 0x15, 0xFF, 0x0D, 0x61, 0x60, 0x0A, 0x32, 0x96, 0x0D, 0x6B, 0xEF, 0x60, 0x0B,
+  0x33, 0x10, 0x0E, 0xC0, 0x01, 0x33, 0x90, 0xFF, 0x0D, 0x5C, 0x60, 0x02, 0x30, 0x21, 0x0D, 0x63, 0xFF, 0x60, 0x03, 0x30, 0x31, 0x0D, 0x75, 0x60,
+  0x0C, 0xFF, 0x30, 0xA2, 0x8D, 0x00, 0x60, 0x01, 0x30, 0xB3, 0xBB, 0x01, 0x73, 0x05, 0xC0, 0x41, 0x00, 0x25, 0x05, 0xC0, 0xC2, 0xFF, 0x40, 0x44,
+  0xF0, 0x00, 0x31, 0x43, 0x40, 0x35, 0xEE, 0x01, 0x40, 0xC4, 0x64, 0x00, 0x11, 0xC0, 0x45, 0x1F, 0x40, 0xEF, 0x60, 0x07, 0x32, 0xC6, 0x22, 0x41,
+  0x33, 0x47, 0x1E, 0xFF, 0xBC, 0x60, 0x0D, 0x33, 0xC0, 0x01, 0x22, 0x60, 0xDF, 0x01, 0x34, 0x40, 0xFD, 0xEE, 0x0D, 0x40, 0x51, 0x7B, 0xDD, 0x8F,
+  0x0D, 0x40, 0xD2, 0xC4, 0x29, 0x1F, 0x40, 0x51, 0x1E, 0xFF, 0xC2, 0x60, 0x0E, 0x32, 0x53, 0xFF, 0x0D, 0x60, 0xDF, 0x02, 0x32, 0xD4, 0x7D, 0x2E,
+  0x05, 0xC0, 0x61, 0xC1, 0xDF, 0x9A, 0x60, 0x04, 0x30, 0xE2, 0x0E, 0xC1, 0x31, 0x61, 0xFE, 0x01, 0x41, 0x32, 0x63, 0x05, 0x2C, 0x60, 0x08, 0x32,
+  0xFF, 0xE4, 0x40, 0x00, 0x83, 0x22, 0xF0, 0x00, 0x03, 0xE1, 0x70, 0x4C, 0x41, 0x58, 0x40, 0x35, 0xC0, 0x01, 0x40, 0x4D, 0xF0, 0x00, 0xFF, 0x02,
+  0x15, 0xD0, 0x80, 0x40, 0x15, 0x20, 0x53, 0xFF, 0xA3, 0x1E, 0xA0, 0xE8, 0x58, 0x06, 0xA3, 0x1D, 0x7F, 0xA0, 0x72, 0x20, 0x64, 0xF0, 0x00, 0xA8,
+  0x0E, 0xC2, 0x7B, 0xA1, 0x28, 0x01, 0x41, 0xA0, 0xB2, 0x02, 0xBB, 0x5C, 0xC1, 0xFE, 0x41, 0xC0, 0x0F, 0xF0, 0x00, 0x05, 0x17, 0x60, 0x0E, 0xFB,
+  0x23, 0xF6, 0x49, 0x43, 0x21, 0x63, 0x41, 0xF5, 0x91, 0xFF, 0x8F, 0x21, 0xF8, 0x40, 0x74, 0xC3, 0xEF, 0x21, 0xBF, 0xE0, 0xF0, 0x00, 0xC3, 0xA4,
+  0x33, 0xC5, 0x40, 0xD8, 0xED, 0x5B, 0x07, 0x41, 0x82, 0x18, 0x01, 0x41, 0x9F, 0xAF, 0x18, 0xDE, 0x01, 0x41, 0x0F, 0x31, 0xF8, 0x90, 0x71, 0xC2,
+  0x90, 0x28, 0xFA, 0x01, 0x41, 0xD0, 0x1F, 0x40, 0x22, 0x78, 0xF0, 0x00, 0x16, 0x7F, 0xD3, 0x60, 0x09, 0xA0, 0x6D, 0x35, 0xF0, 0x38, 0xC1, 0x1A,
+  0x17, 0xC0, 0x61, 0x5B, 0x41, 0x03, 0xA5, 0x28, 0x41, 0x35, 0xC0, 0x04, 0x41, 0xF5, 0x6B, 0x04, 0x47, 0x21, 0x11, 0xC0, 0x83, 0x6D, 0x22, 0xF1,
+  0xF6, 0x1D, 0xC1, 0x23, 0x77, 0x74, 0xC0, 0x41, 0x36, 0x70, 0xF0, 0xE7, 0x00, 0x9E, 0x79, 0x14, 0xC0, 0x65, 0xC0, 0x32, 0xF1, 0xD0, 0xDF, 0x08,
+  0x91, 0xC7, 0x33, 0x75, 0x07, 0x41, 0x34, 0x70, 0xB5, 0xE6, 0x01, 0x41, 0xF0, 0x01, 0x41, 0x24, 0x74, 0x04, 0x41, 0x24, 0xFE, 0x6B, 0xC0, 0x8C,
+  0x24, 0x26, 0xF2, 0x40, 0x16, 0x8A, 0xFF, 0x1B, 0x34, 0x74, 0x4F, 0xF5, 0x82, 0xB7, 0x34, 0x7C, 0x04, 0x40, 0x92, 0xC0, 0x71, 0x90, 0x05, 0x83,
+  0x04, 0x29, 0xC1, 0x63, 0x8E, 0x67, 0x34, 0x43, 0x13, 0x40, 0x29, 0xC0, 0x36, 0xF6, 0x11, 0xC2, 0x5F, 0xF0, 0x80, 0x06, 0x82, 0xAF, 0x32, 0xC2,
+  0x1B, 0x2C, 0xC0, 0xB7, 0x09, 0x8E, 0x5F, 0x08, 0xC5, 0xD0, 0x09, 0x08, 0xC0, 0xF5, 0xFC, 0x1A, 0xC3, 0x84, 0xC0, 0x11, 0x27, 0x72, 0xA2, 0xE9,
+  0x90, 0xFF, 0x8A, 0x20, 0xF3, 0xA2, 0xE8, 0x8E, 0xD7, 0x37, 0x4D, 0x72, 0x05, 0xC1, 0x37, 0xF1, 0x1F, 0x41, 0x3A, 0x44, 0x7A, 0x3A, 0x40, 0x7D,
+  0xC3, 0x3A, 0x40, 0x46, 0xF0, 0x00, 0x18, 0x20, 0x07, 0x41, 0xB9, 0x35, 0x0D, 0x40, 0x2C, 0xC0, 0x7A, 0xD0, 0x08, 0x54, 0xC0, 0x08, 0xFF, 0xA2,
+  0xDF, 0x82, 0x00, 0x21, 0x06, 0x40, 0x03, 0xFB, 0x33, 0x80, 0x89, 0xC0, 0x09, 0x37, 0x00, 0x0D, 0x6D, 0xFF, 0x60, 0x0A, 0x37, 0x80, 0x0D, 0x30,
+  0x60, 0x0B, 0xFF, 0x36, 0x83, 0x0D, 0x40, 0x60, 0x0C, 0x35, 0x80, 0xFF, 0x70, 0x00, 0xC8, 0x88, 0xF0, 0x00, 0x10, 0x10, 0xFA, 0x0D, 0x41, 0x10,
+  0x10, 0x40, 0x32, 0x86, 0x40, 0x15, 0xC8, 0xD5, 0x90, 0x02, 0xC0, 0x30, 0x04, 0x42, 0x40, 0x01, 0x41, 0x33, 0x05, 0xF8, 0x1A, 0xC1, 0x98, 0xC0,
+  0x68, 0xC1, 0x63, 0x60, 0x0E, 0x24, 0xF7, 0xBF, 0x05, 0x1D, 0x60, 0x0D, 0x25, 0x76, 0x2C, 0xC1, 0x91, 0xDF, 0xC7, 0x20, 0xE8, 0x40, 0x15, 0x6A,
+  0x40, 0xE9, 0xD4, 0xFF, 0x09, 0xC3, 0xEF, 0x20, 0x00, 0x40, 0x12, 0x9F, 0xFF, 0xBE, 0x20, 0x11, 0x58, 0x03, 0xA0, 0x80, 0x35, 0xE9, 0x77, 0x4F,
+  0x41, 0x29, 0xC3, 0x21, 0x34, 0x40, 0xA0, 0xCA, 0x22, 0xDF, 0x54, 0xF0, 0x00, 0xCC, 0x09, 0x79, 0x40, 0x0C, 0x83, 0xF5, 0x2C, 0x0E, 0xC1, 0x8A,
+  0x82, 0x42, 0xAE, 0x48, 0x22, 0x45, 0x9F, 0xA2, 0xC3, 0xA2, 0x28, 0x20, 0x6D, 0x40, 0x2F, 0xC0, 0xF0, 0xD0, 0x01, 0x41, 0x76, 0x41, 0xC1, 0xC0,
+  0x71, 0xC1, 0xE3, 0x37, 0x40, 0x27, 0x89, 0xD7, 0x01, 0x23, 0xF4, 0x55, 0x42, 0xF2, 0x4C, 0x40, 0x61, 0x21, 0xF5, 0x73, 0x13, 0x40, 0x50, 0x68,
+  0xC1, 0xA0, 0x58, 0x23, 0x72, 0xDF, 0xE1, 0x40, 0xA8, 0x01, 0x22, 0x5C, 0xC0, 0x90, 0x49, 0xDF, 0x22, 0x75, 0xE0, 0x40, 0x80, 0x14, 0xC2, 0x8A,
+  0x51, 0x6D, 0x33, 0x73, 0x40, 0xA0, 0x58, 0x02, 0xC1, 0xAF, 0x48, 0x56, 0xC3, 0xFB, 0x34, 0x70, 0xDD, 0xC2, 0x75, 0x60, 0x08, 0x90, 0x09, 0xD7,
+  0x0D, 0x00, 0x60, 0x59, 0xC0, 0x35, 0x05, 0xC2, 0x33, 0x80, 0x59, 0xC0, 0x8E, 0x40, 0x40, 0x43, 0x34, 0x81, 0x08, 0xC0, 0x49, 0x08, 0xC1, 0xFE,
+  0x2E, 0x41, 0x8F, 0xFD, 0x04, 0x00, 0x60, 0x00, 0xA2, 0xFF, 0xA9, 0x8E, 0xC0, 0x40, 0x00, 0x60, 0x05, 0x60, 0x4E, 0x00, 0xC0, 0xE6, 0x00, 0xC8,
+  0x6B, 0xC0, 0xA1, 0xC0, 0xDB, 0x57, 0x41, 0xBD, 0x83, 0xA3, 0x42, 0x9E, 0xBA, 0x30, 0x03, 0x2B, 0x42, 0x84, 0x09, 0xD4, 0x14, 0xC0, 0x0D, 0x40,
+  0xC1, 0x4A, 0xC2, 0xF7, 0x44, 0x88, 0x40, 0x07, 0x42, 0xBF, 0x27, 0x94, 0xD0, 0x08, 0xA0, 0x03, 0x0B, 0xC1, 0x00, 0x7B, 0x11, 0x08, 0x01, 0x44,
+  0xC0, 0x0E, 0xA0, 0x09, 0x01, 0xC1, 0x9B, 0xA0, 0x09, 0x05, 0xC1, 0xA4, 0x08, 0x4A, 0xC1, 0x08, 0xCE, 0x26, 0xDE, 0x08, 0xCF, 0xF0, 0x00, 0x1D,
+  0x01, 0x17, 0xC1, 0x0A, 0x2C, 0x7D, 0x60, 0x04, 0xC0, 0x01, 0x1A, 0x60, 0x01, 0x31, 0x1D, 0xC0, 0xFA, 0xE5, 0x40, 0x81, 0x07, 0x41, 0xA8, 0x01,
+  0x7F, 0xFF, 0x60, 0x77, 0x06, 0xCC, 0x0A, 0x9E, 0xC2, 0xA1, 0x31, 0x06, 0x83, 0xC2, 0xFF, 0x06, 0xD4, 0x09, 0xAE, 0xE8, 0x04, 0xDF, 0xD0, 0xFF,
+  0x80, 0x90, 0x87, 0x70, 0x00, 0x98, 0x07, 0xF0, 0xFF, 0x00, 0x0F, 0xB1, 0xD2, 0x80, 0x9E, 0x08, 0x41, 0xFF, 0x89, 0x60, 0x06, 0x14, 0x92, 0x60,
+  0x00, 0x90, 0xB7, 0x04, 0xA1, 0x98, 0x14, 0xC1, 0xAA, 0x56, 0x0D, 0x41, 0xA2, 0xF3, 0x20, 0x32, 0x0D, 0x43, 0xC6, 0xC0, 0x91, 0xC2, 0x06, 0x9A,
+  0xFF, 0x60, 0x08, 0x41, 0xE6, 0x06, 0x00, 0xD0, 0x80, 0x9F, 0x82, 0x13, 0x70, 0x00, 0xD8, 0x34, 0x40, 0x0E, 0xC3, 0x10, 0x7F, 0x62, 0x60, 0x01,
+  0x05, 0x1F, 0x60, 0x05, 0xAC, 0x41, 0xBF, 0x06, 0xE6, 0x60, 0x08, 0xA3, 0x65, 0x59, 0xC3, 0x30, 0xFF, 0x85, 0xD0, 0x08, 0x10, 0x00, 0x60, 0x03,
+  0xA2, 0xDF, 0x75, 0x30, 0x23, 0x07, 0x73, 0xD7, 0xC1, 0x07, 0xC6, 0xF7, 0xD0, 0x80, 0x08, 0x04, 0x40, 0xA0, 0x02, 0x0E, 0x6F, 0xEA, 0x44, 0x41,
+  0x02, 0x02, 0xC0, 0x80, 0x0A, 0x40, 0x07, 0x73, 0xD0, 0xFF, 0x80, 0x40, 0xE0, 0x00, 0x1F, 0x60, 0x01, 0x13, 0x7F, 0xD5, 0x60, 0x07, 0xA0, 0x11,
+  0x90, 0x40, 0x10, 0x41, 0xFF, 0x13, 0xFB, 0x60, 0x06, 0xA0, 0x0E, 0x14, 0x05, 0xEE, 0x01, 0x40, 0x0D, 0x14, 0x0F, 0x01, 0x40, 0x0C, 0x45, 0x60,
+  0xAB, 0x00, 0x3A, 0x08, 0xC0, 0xB6, 0x08, 0xC0, 0x0B, 0x08, 0xC4, 0xF7, 0xEE, 0x05, 0xC0, 0x08, 0x14, 0x01, 0x01, 0x40, 0x07, 0x14, 0x0B, 0xBE,
+  0x01, 0x40, 0x06, 0x41, 0x80, 0x00, 0x3B, 0x08, 0xC4, 0x05, 0xCA, 0x08, 0xC8, 0x02, 0x08, 0xC2, 0x01, 0x08, 0xC1, 0x1C, 0x41, 0x0D, 0x28, 0xFF,
+  0xD0, 0x80, 0xD7, 0xCA, 0x00, 0xFF, 0x60, 0x04, 0x7F, 0x81, 0xD7, 0x0C, 0xF7, 0x60, 0x09, 0xD0, 0x3B, 0xC2, 0xFF, 0x82, 0x76, 0x30, 0x17, 0xF0,
+  0x00, 0xD0, 0xF6, 0xFF, 0x40, 0x83, 0xF0, 0x00, 0xC1, 0xA4, 0x20, 0x19, 0xFA, 0x04, 0x40, 0xF6, 0x05, 0xC1, 0xC1, 0x80, 0x20, 0x17, 0xA2, 0xB7,
+  0x54, 0xC3, 0xE7, 0x02, 0xC1, 0xC5, 0xC7, 0x37, 0x44, 0x17, 0x6F, 0xD0, 0x08, 0x9A, 0x78, 0x02, 0xC1, 0x9A, 0x70, 0xF4, 0x40, 0xB9, 0xE3, 0xF5,
+  0xC2, 0x01, 0x40, 0x0D, 0x67, 0xD0, 0x3A, 0x40, 0x70, 0xFB, 0x00, 0xA1, 0x0F, 0x40, 0x70, 0x00, 0x80, 0xD2, 0x1E, 0xF5, 0xC8, 0xDF, 0x40, 0x4A,
+  0xAC, 0x40, 0x00, 0xA2, 0x49, 0x90, 0x28, 0x67, 0x42, 0x05, 0xC1, 0x88, 0x44, 0xA5, 0x07, 0x42, 0x45, 0x13, 0x40, 0x6B, 0xC0, 0xFB, 0x00, 0x28,
+  0x98, 0xC0, 0x43, 0x9E, 0x38, 0x0E, 0xF4, 0xFF, 0x60, 0x09, 0x9E, 0x38, 0x70, 0x00, 0x9F, 0xFF, 0xBE, 0xCD, 0x43, 0x40, 0x40, 0x0C, 0x8A, 0xD5,
+  0x14, 0xC0, 0x0C, 0xD9, 0x8B, 0x50, 0xC1, 0x5C, 0xC1, 0x9C, 0x39, 0x11, 0xC1, 0x9C, 0x31, 0xF8, 0x1C, 0x40, 0x94, 0xC0, 0x01, 0x40, 0x02, 0x40,
+  0x10, 0x70, 0x00, 0xFF, 0xAF, 0xF3, 0x41, 0xF1, 0x40, 0x40, 0x80, 0x0D, 0xED, 0x40, 0x04, 0x40, 0xAF, 0xF1, 0x02, 0xC2, 0x0C, 0x03, 0xE8, 0xFF,
+  0x60, 0x02, 0xA2, 0x35, 0x90, 0x83, 0x10, 0x44, 0xED, 0xD1, 0x0E, 0xC0, 0x10, 0x42, 0x59, 0xC0, 0x71, 0x40, 0x20, 0xFF, 0xA0, 0x08, 0x43, 0xA1,
+  0x40, 0x30, 0xA0, 0x07, 0xB3, 0x43, 0xB1, 0x01, 0x40, 0x78, 0x40, 0x10, 0x75, 0x05, 0xC4, 0x04, 0xB2, 0x05, 0xC2, 0x02, 0x05, 0xC2, 0xEC, 0xC0,
+  0x10, 0x81, 0x32, 0xC1, 0x0C, 0xBD, 0x92, 0x01, 0x42, 0x94, 0xD0, 0x80, 0xA0, 0x19, 0x40, 0x31, 0xFF, 0x7C, 0xA6, 0x50, 0x7C, 0x4D, 0x20, 0x83,
+  0x80, 0xF7, 0x09, 0x21, 0xF8, 0xD6, 0x40, 0xD0, 0x70, 0x00, 0x18, 0xDF, 0x41, 0xA6, 0x53, 0x15, 0x36, 0x08, 0xC1, 0x0B, 0xC9, 0xB6, 0xA3, 0x41,
+  0x1D, 0x8D, 0x29, 0xC1, 0x16, 0xD5, 0x04, 0x48, 0x8F, 0xFE, 0x04, 0x42, 0xDA, 0xD0, 0x80, 0x3E, 0x91, 0x1F, 0x5F, 0x7E, 0x02, 0xC1, 0x23, 0x8A,
+  0xD0, 0x80, 0x0D, 0x85, 0x3E, 0xC0, 0xB9, 0x1B, 0x3E, 0xC3, 0x35, 0xC0, 0x88, 0x60, 0x0B, 0x84, 0x40, 0x30, 0xFD, 0x60, 0x34, 0x40, 0x09, 0x38,
+  0x60, 0x04, 0x9F, 0x98, 0xFF, 0x01, 0x2C, 0x60, 0x05, 0xF0, 0x00, 0x2E, 0xB3, 0xF9, 0xEE, 0x3A, 0xC0, 0x9A, 0x42, 0x09, 0x0D, 0x87, 0x60, 0x0C,
+  0x7B, 0x9F, 0x90, 0x3B, 0xC1, 0x9F, 0x88, 0x2F, 0x34, 0x05, 0xC1, 0xFF, 0x2F, 0xB5, 0xEE, 0x00, 0x30, 0x43, 0x0B, 0x42, 0xD6, 0x19, 0x41, 0x30,
+  0xC4, 0x56, 0xC1, 0x31, 0x53, 0x40, 0xF0, 0x00, 0xF7, 0x2C, 0xB1, 0x40, 0x72, 0x40, 0x2D, 0x32, 0xF0, 0x00, 0xF7, 0xC6, 0x79, 0x22, 0x11, 0x40,
+  0xF0, 0x00, 0x3D, 0x81, 0xFC, 0x01, 0x42, 0x35, 0x40, 0xDD, 0x6D, 0x1B, 0x93, 0xD2, 0x80, 0xBB, 0x90, 0x46, 0x1F, 0xC0, 0x0A, 0x20, 0x42, 0x02,
+  0xC1, 0xDA, 0xFF, 0xC9, 0x20, 0x25, 0xA2, 0x04, 0x8C, 0x69, 0x2D, 0x6D, 0xB3, 0x07, 0x40, 0x49, 0x32, 0x08, 0xC0, 0x8D, 0x89, 0x58, 0x41, 0xFF,
+  0x3C, 0x81, 0xFE, 0x35, 0x60, 0x00, 0x35, 0x81, 0xFF, 0x00, 0x16, 0x60, 0x01, 0xA0, 0x18, 0x21, 0x46, 0xFF, 0xF0, 0x00, 0xAA, 0x07, 0x01, 0x2D,
+  0x60, 0x00, 0xDB, 0x81, 0xCF, 0x07, 0x41, 0x8F, 0x80, 0x73, 0x45, 0x94, 0x02, 0xFF, 0x40, 0x45, 0x57, 0x4B, 0x60, 0x00, 0xE0, 0x00, 0xFF, 0x60,
+  0x01, 0x80, 0x02, 0x40, 0x65, 0x40, 0x00, 0xEF, 0x60, 0x00, 0xC6, 0x66, 0x02, 0xC0, 0x00, 0xA0, 0x30, 0xFE, 0x02, 0xC0, 0x04, 0xAF, 0x4E, 0x00,
+  0xA4, 0x60, 0x05, 0x6F, 0x81, 0x8E, 0x0B, 0x75, 0x29, 0xC1, 0x14, 0x74, 0x40, 0x41, 0xFF, 0x1B, 0x90, 0xD2, 0x80, 0x2E, 0x34, 0x04, 0x00, 0xEF,
+  0x60, 0x06, 0x20, 0xC2, 0x20, 0xC1, 0xD2, 0xC9, 0x03, 0xFD, 0xE9, 0x08, 0xC2, 0x59, 0x60, 0x08, 0x8F, 0x2D, 0x31, 0xFD, 0xC6, 0x16, 0x47, 0xB1,
+  0x5C, 0x60, 0x03, 0x46, 0x66, 0x7B, 0x60, 0x07, 0x16, 0x41, 0xAA, 0xCE, 0x60, 0x03, 0x16, 0x40, 0xED, 0x07, 0x16, 0x40, 0xE0, 0x00, 0x49, 0x40,
+  0xAF, 0x48, 0x00, 0x5D, 0x1D, 0x0D, 0x40, 0xC7, 0x31, 0x84, 0x3E, 0x40, 0x05, 0x16, 0x47, 0xE7, 0xF0, 0x00, 0xD8, 0x20, 0xC0, 0x5F, 0xC0, 0x67,
+  0x60, 0x08, 0xA7, 0x21, 0xC6, 0x20, 0x20, 0xC0, 0xC1, 0xC0, 0x33, 0x0A, 0x40, 0x86, 0xCF, 0x31, 0x84, 0x40, 0x07, 0x0A, 0x47, 0x68, 0xC1, 0x6E,
+  0x6C, 0xFF, 0x60, 0x03, 0x40, 0x07, 0x00, 0xE5, 0x60, 0x05, 0xFF, 0xA0, 0x58, 0xFF, 0xFF, 0x60, 0x03, 0xAA, 0x24, 0xBF, 0x0B, 0x52, 0x60, 0x08,
+  0x81, 0x1C, 0x37, 0x41, 0x31, 0x7F, 0x05, 0x7F, 0xDF, 0x60, 0x06, 0x31, 0x84, 0x0B, 0xC7, 0x2F, 0x91, 0x83, 0x2E, 0x85, 0x26, 0xC1, 0x2F, 0x8D,
+  0xC0, 0x01, 0x40, 0xFD, 0x87, 0x78, 0xC2, 0x09, 0xA1, 0xCF, 0x3E, 0x11, 0x0D, 0xFF, 0x82, 0x60, 0x0A, 0xF0, 0x00, 0x27, 0x11, 0xA1, 0xDF, 0xCD,
+  0xA0, 0x50, 0x27, 0x92, 0x4A, 0xC0, 0x41, 0x0B, 0xFF, 0xB4, 0x60, 0x0C, 0x80, 0x52, 0x20, 0x21, 0xA1, 0xEF, 0xCA, 0x9E, 0xCB, 0x35, 0x04, 0x40,
+  0x90, 0x41, 0x70, 0xDF, 0x00, 0xD8, 0x09, 0x88, 0x2D, 0xBF, 0xC3, 0x36, 0x15, 0xFE, 0x10, 0x41, 0x36, 0x95, 0xF0, 0x00, 0x91, 0x00, 0x30, 0xDD,
+  0xA6, 0x1A, 0xC0, 0x27, 0x14, 0x62, 0x65, 0xC0, 0x04, 0x31, 0xFF, 0xC0, 0xF0, 0x00, 0x21, 0x45, 0x8C, 0xCD, 0x60, 0xDE, 0x18, 0x40, 0xFF, 0x55,
+  0x60, 0x07, 0x4C, 0x45, 0x32, 0x40, 0xB6, 0x0B, 0xC1, 0x32, 0xC1, 0x01, 0x41, 0x33, 0x42, 0xF1, 0x42, 0x82, 0xF1, 0x60, 0x11, 0xC0, 0x1F, 0xC0,
+  0x1D, 0xC0, 0x20, 0x15, 0xA1, 0xB9, 0xFF, 0x91, 0x45, 0x7F, 0xEC, 0x60, 0x06, 0x40, 0x47, 0xDE, 0x17, 0xC1, 0x20, 0x90, 0x14, 0x47, 0x0D, 0x41,
+  0x34, 0xA0, 0xFA, 0x13, 0x40, 0x10, 0x02, 0xC3, 0x35, 0x20, 0xD0, 0x08, 0x0A, 0x7F, 0x3D, 0x60, 0x07, 0xA1, 0xB2, 0xA2, 0x79, 0x2D, 0x41, 0xFB,
+  0xA2, 0xBA, 0x38, 0xC1, 0x90, 0xC0, 0x3B, 0x91, 0xF0, 0xA7, 0x00, 0x3B, 0x12, 0x1F, 0x41, 0x7C, 0xC0, 0x10, 0xA3, 0x41, 0x0B, 0x7F, 0x60, 0x60,
+  0x0E, 0xF0, 0x00, 0x00, 0x04, 0x46, 0x40, 0xFF, 0xA7, 0x3F, 0xFC, 0x60, 0x04, 0x32, 0x63, 0x80, 0xFF, 0x08, 0x60, 0x05, 0x32, 0xE4, 0x19, 0x9A,
+  0x60, 0xFF, 0x06, 0x33, 0x65, 0x0D, 0x86, 0x60, 0x0F, 0x31, 0xCD, 0xE6, 0x0E, 0xC1, 0x30, 0x77, 0xE8, 0x41, 0x3E, 0x41, 0xA1, 0xA4, 0x7A, 0x03,
+  0x40, 0x20, 0x0C, 0xC0, 0xD2, 0x60, 0x01, 0x94, 0xB2, 0x40, 0xFE, 0x01, 0xC0, 0x02, 0x00, 0xFA, 0x60, 0x03, 0xAF, 0xED, 0xEF, 0xF0, 0x00, 0xBE,
+  0x77, 0x32, 0xC1, 0x4B, 0x00, 0x60, 0xFF, 0x07, 0x37, 0x06, 0x00, 0x01, 0x60, 0x01, 0x37, 0x3D, 0x87, 0xE5, 0xC1, 0xF0, 0x00, 0x03, 0x84, 0x65,
+  0xC1, 0x04, 0x40, 0xB6, 0xA8, 0x40, 0x00, 0x8C, 0x08, 0xC1, 0x0A, 0xF0, 0x3B, 0xC1, 0x70, 0xD7, 0x00, 0x8F, 0xC7, 0x20, 0xC0, 0xB4, 0x37, 0x41,
+  0x00, 0x11, 0x7E, 0x07, 0x42, 0x11, 0x60, 0x06, 0x3B, 0x05, 0x10, 0x10, 0x40, 0xFB, 0x3B, 0x86, 0x25, 0x40, 0x00, 0x3C, 0x07, 0xAD, 0x84, 0xFF,
+  0x60, 0x01, 0x32, 0x10, 0x01, 0xFD, 0x60, 0x02, 0xFF, 0x32, 0x91, 0x0B, 0x5E, 0x60, 0x03, 0x33, 0x12, 0xFF, 0x0C, 0x80, 0x60, 0x04, 0x31, 0x93,
+  0x00, 0xA0, 0xFF, 0x60, 0x05, 0x34, 0x84, 0xFF, 0xD0, 0x60, 0x06, 0xFF, 0x35, 0x05, 0xE3, 0x54, 0x60, 0x07, 0x36, 0x06, 0xAD, 0x34, 0x82, 0x40,
+  0x36, 0x86, 0x1D, 0xC2, 0x07, 0x1D, 0xC1, 0x37, 0xFE, 0xAD, 0xC0, 0x8F, 0xB7, 0x80, 0xE5, 0x7F, 0xFF, 0x60, 0xF7, 0x00, 0xCC, 0x0A, 0x31, 0x41,
+  0x8E, 0xA9, 0x33, 0x70, 0xFF, 0xF0, 0x00, 0xAF, 0x20, 0x34, 0x70, 0xD4, 0x09, 0xFB, 0xAE, 0xE8, 0x04, 0x41, 0xA8, 0x05, 0x00, 0x80, 0x60, 0xFF,
+  0x07, 0xA8, 0xF6, 0x33, 0x75, 0xF0, 0x00, 0xC3, 0xDD, 0x86, 0xBB, 0x42, 0x7F, 0x33, 0xF6, 0x05, 0xC0, 0x85, 0x1D, 0xAB, 0xE4, 0xD1, 0x55, 0x41,
+  0x75, 0x3D, 0x40, 0x86, 0x7D, 0xC0, 0x7B, 0xEF, 0x20, 0x12, 0x1F, 0x32, 0x56, 0xC2, 0x82, 0xD0, 0x08, 0xFB, 0x90, 0x82, 0x04, 0xC1, 0x40, 0xA7,
+  0x40, 0x77, 0xE6, 0xBC, 0x6A, 0xC0, 0xC7, 0x43, 0x30, 0x17, 0xD0, 0x08, 0x32, 0x40, 0x08, 0xA3, 0xA1, 0x74, 0x78, 0x40, 0x08, 0xC0, 0xF7, 0x40,
+  0x61, 0xC1, 0x41, 0x09, 0xF0, 0x5F, 0xC0, 0x66, 0x40, 0x0E, 0x40, 0x6E, 0xC0, 0x91, 0xA1, 0x6F, 0xA2, 0xFD, 0x08, 0x52, 0x41, 0x00, 0xCF, 0x60,
+  0x02, 0xA0, 0x01, 0xFF, 0x01, 0x51, 0x60, 0x02, 0x80, 0x01, 0x0D, 0x8B, 0x8B, 0x60, 0x08, 0x01, 0x40, 0x8C, 0x01, 0x40, 0xC2, 0xC2, 0x13, 0x42,
+  0x02, 0xEF, 0xD0, 0x08, 0x0F, 0xF2, 0x1D, 0xC0, 0x67, 0x20, 0x11, 0xB4, 0x07, 0xC0, 0x7D, 0xC0, 0x2C, 0x95, 0xC2, 0x20, 0x11, 0xCB, 0xC3, 0x93,
+  0xFD, 0xFE, 0x01, 0x41, 0xF2, 0x00, 0x31, 0x22, 0x20, 0x31, 0x5B, 0xD0, 0x80, 0x10, 0x41, 0xA0, 0x03, 0x17, 0xC0, 0x22, 0x02, 0xC0, 0x9A, 0x11,
+  0xC0, 0xA0, 0xF6, 0x40, 0x20, 0x1E, 0xBC, 0xC1, 0x13, 0x41, 0x20, 0x77, 0x00, 0x0E, 0x69, 0x22, 0x41, 0x01, 0xD0, 0x60, 0x05, 0xC0, 0xFD, 0x30,
+  0x22, 0x42, 0x30, 0x01, 0xD0, 0x08, 0x83, 0x6D, 0xFF, 0x0C, 0x35, 0x60, 0x08, 0x40, 0x60, 0x3A, 0x4D, 0xBF, 0x60, 0x01, 0x41, 0xE2, 0x21, 0x96,
+  0x56, 0xC0, 0x00, 0x6B, 0x41, 0x44, 0x9C, 0xC0, 0x81, 0x0D, 0x41, 0x34, 0x02, 0x01, 0x42, 0xFF, 0x83, 0x0C, 0x29, 0x60, 0x09, 0x35, 0x04, 0x3A,
+  0xFF, 0x5B, 0x60, 0x00, 0x35, 0x85, 0x3A, 0x60, 0x60, 0xB7, 0x03, 0x30, 0x90, 0x05, 0xC1, 0x33, 0x93, 0x56, 0xC0, 0xDF, 0xB6, 0x17, 0xC1, 0xAE,
+  0x6C, 0x01, 0x41, 0x8E, 0x9F, 0x02, 0xC2, 0x98, 0x6F, 0xF0, 0x00, 0x0C, 0x51, 0x49, 0x41, 0x21, 0xA0, 0x1F, 0x41, 0xBB, 0x05, 0x2E, 0x02, 0xC1,
+  0x70, 0x00, 0xA0, 0x98, 0xC0, 0x21, 0x59, 0xB7, 0x04, 0x41, 0x50, 0xC3, 0x1E, 0x84, 0x08, 0xC2, 0xE0, 0x04, 0x41, 0xDB, 0x1E, 0xA4, 0x02, 0xC1,
+  0x07, 0xF7, 0x01, 0x41, 0x22, 0x15, 0xF6, 0x04, 0x41, 0x07, 0xFB, 0x02, 0xC2, 0x8F, 0xD0, 0x80, 0x40, 0xFF, 0x40, 0x22, 0xE1, 0xD2, 0x80, 0x40,
+  0x80, 0x22, 0xD5, 0xE2, 0x04, 0x42, 0x9C, 0x07, 0x48, 0xB6, 0x02, 0xC1, 0x20, 0xF0, 0xFE, 0xD1, 0xC0, 0x02, 0x27, 0xDF, 0xD2, 0x80, 0x9E, 0x69,
+  0xF6, 0x4D, 0xC3, 0x07, 0x00, 0x6D, 0x41, 0x23, 0x20, 0xD0, 0x80, 0x7B, 0x90, 0x82, 0x2E, 0x41, 0x40, 0x17, 0x40, 0x67, 0x68, 0xC7, 0xD9, 0x32,
+  0x68, 0xC0, 0x1A, 0xC5, 0x27, 0xEA, 0x01, 0x41, 0x11, 0xB5, 0xEE, 0x19, 0x40, 0x55, 0x15, 0x17, 0x47, 0xC1, 0x1D, 0x40, 0x60, 0xFF, 0x00, 0x31,
+  0x05, 0x1E, 0x60, 0x60, 0x01, 0x31, 0x4D, 0x85, 0x0B, 0xC1, 0x32, 0x05, 0x01, 0x42, 0x02, 0xC2, 0x33, 0x10, 0x42, 0xFF, 0x33, 0x81, 0x0D, 0x8E,
+  0x60, 0x09, 0x34, 0x00, 0xFF, 0x02, 0x54, 0x60, 0x02, 0x34, 0x81, 0x38, 0x80, 0xF2, 0x43, 0x40, 0x12, 0xC7, 0x42, 0x43, 0x40, 0xD0, 0x08, 0x17,
+  0x0B, 0x7F, 0x60, 0x0C, 0xA1, 0x1F, 0x00, 0x40, 0x40, 0xB1, 0xC1, 0xF7, 0x41, 0x24, 0x3F, 0x28, 0x41, 0x0C, 0x83, 0x60, 0x08, 0xDF, 0x90, 0x00,
+  0x0C, 0x6B, 0x60, 0xCA, 0x40, 0x70, 0x0C, 0x41, 0xE6, 0x63, 0x41, 0x69, 0xC0, 0x2F, 0xC0, 0xC3, 0xC0, 0xE2, 0xC0, 0xB3, 0x01, 0x41, 0x7B, 0x3C,
+  0x34, 0x25, 0x41, 0x70, 0x00, 0xAD, 0xC8, 0x0B, 0xC0, 0xFD, 0x8D, 0x22, 0x41, 0x26, 0x0A, 0xD0, 0x80, 0x83, 0xFF, 0xDB, 0x0D, 0x9B, 0x6D, 0x42,
+  0xF4, 0x60, 0x08, 0xC0, 0x03, 0xB1, 0xFF, 0x60, 0x01, 0x10, 0x00, 0x03, 0xB2, 0x60, 0x02, 0xFF, 0x10, 0x01, 0x04, 0x0E, 0x60, 0x00, 0x10, 0x02,
+  0x5B, 0x04, 0x0F, 0x04, 0x41, 0x04, 0x5C, 0x04, 0x42, 0x5D, 0x04, 0x41, 0xFB, 0x13, 0x80, 0x04, 0x41, 0x0D, 0xAB, 0x60, 0x09, 0x10, 0x77, 0x01,
+  0x02, 0xEE, 0x04, 0x40, 0x07, 0x43, 0x06, 0x04, 0x40, 0x77, 0x10, 0x04, 0x69, 0x08, 0xC0, 0x11, 0x44, 0x87, 0x04, 0x40, 0xB7, 0x12, 0x05, 0xE3,
+  0x04, 0x41, 0x46, 0x08, 0x04, 0x41, 0x06, 0xFD, 0xAE, 0x04, 0x41, 0x0D, 0xA4, 0x60, 0x08, 0x10, 0x10, 0xBB, 0x9E, 0x3C, 0x02, 0xC0, 0x17, 0x0D,
+  0xB3, 0x0E, 0xC0, 0x00, 0xDB, 0x25, 0xDA, 0x0E, 0xC1, 0x80, 0x3D, 0x0A, 0x41, 0x28, 0x82, 0xB6, 0x0A, 0x41, 0xC0, 0x3D, 0x0A, 0x41, 0x28, 0x87,
+  0x04, 0x41, 0xC0, 0x8D, 0x3B, 0x04, 0x41, 0x28, 0x8C, 0x04, 0x41, 0x02, 0xC0, 0x08, 0xC1, 0x91, 0xAA, 0x08, 0xC2, 0x3B, 0x08, 0xC2, 0x96, 0x08,
+  0xC8, 0x9B, 0x08, 0xC8, 0xA0, 0xBA, 0x04, 0x41, 0x40, 0x19, 0x41, 0x12, 0x28, 0xA5, 0x08, 0xC2, 0x3C, 0x2A, 0x08, 0xC2, 0xAA, 0x08, 0xC2, 0x3C,
+  0x08, 0xC2, 0xAF, 0x11, 0xC2, 0x08, 0xC3, 0xD5, 0xB4, 0x08, 0xC8, 0xB9, 0x08, 0xC8, 0xBE, 0x08, 0xC7, 0x29, 0xCC, 0x36, 0x04, 0x41, 0x00, 0x37,
+  0x04, 0x41, 0x29, 0xD1, 0x04, 0x41, 0x02, 0xC0, 0x46, 0x04, 0x40, 0x29, 0xD6, 0x04, 0x41, 0x02, 0xC0, 0x08, 0xC1, 0xDB, 0x08, 0xC7, 0xBB, 0x0D,
+  0xD8, 0x3A, 0x40, 0x12, 0x27, 0x15, 0x3A, 0x41, 0x40, 0xAD, 0x3E, 0x4A, 0xC1, 0x27, 0x1A, 0x4F, 0x41, 0x80, 0x13, 0x41, 0x02, 0x63, 0x28, 0x64,
+  0x04, 0x41, 0x28, 0x40, 0x04, 0x40, 0x28, 0x69, 0x04, 0x41, 0xAC, 0x02, 0xC0, 0x04, 0x40, 0x28, 0x6E, 0x08, 0xC2, 0x3A, 0x08, 0xC2, 0x73, 0x08,
+  0x04, 0x41, 0x02, 0xC0, 0x08, 0xC1, 0xA0, 0x08, 0xC7, 0x22, 0x40, 0x04, 0x40, 0x1C, 0x42, 0x11, 0x02, 0x22, 0x40, 0x04, 0x40, 0x1C, 0x42, 0x01,
+  0x22, 0x40, 0x04, 0x40, 0x25, 0x42, 0x99, 0x00, 0x22, 0x40, 0x08, 0xC6, 0x0D, 0xEF, 0x59, 0xC1, 0x8E, 0x41, 0x10, 0xF5, 0x07, 0x01, 0x42, 0x17,
+  0x8F, 0xC1, 0x0C, 0xDF, 0x60, 0x0B, 0xBF, 0xA0, 0xBF, 0x30, 0x30, 0x23, 0xD6, 0xA6, 0x41, 0x26, 0xD9, 0xE8, 0xF2, 0xC0, 0x80, 0x40, 0xA0, 0xBC,
+  0x93, 0x40, 0x02, 0xA0, 0xF7, 0xBB, 0x90, 0x82, 0x0A, 0x41, 0x82, 0x8A, 0x70, 0x00, 0xC7, 0x90, 0x03, 0x90, 0x01, 0x41, 0xF2, 0xC0, 0xE0, 0xC0,
+  0xFB, 0x82, 0x6D, 0xBF, 0xB6, 0xC3, 0x01, 0x99, 0x0D, 0x41, 0x0D, 0x9A, 0x8F, 0xC2, 0x29, 0xC1, 0x04, 0x41, 0x0D, 0x40, 0xB2, 0x0D, 0x56, 0x80,
+  0x0D, 0x43, 0x1D, 0xC1, 0xFE, 0x0D, 0x40, 0xAB, 0x60, 0x0D, 0xF0, 0x00, 0x3F, 0xFF, 0xFB, 0x60, 0x02, 0x0D, 0x40, 0x51, 0xA0, 0xA9, 0xC2, 0x53,
+  0xF6, 0x07, 0x41, 0x8E, 0xC4, 0x0B, 0xC5, 0x97, 0xFC, 0xD4, 0x8F, 0x76, 0x17, 0xC1, 0x40, 0x05, 0x8B, 0x40, 0x0D, 0x40, 0x17, 0x0A, 0x41, 0xEB,
+  0x9F, 0x7D, 0x0A, 0x40, 0xA2, 0x0A, 0x43, 0x82, 0xC4, 0x27, 0xB9, 0x1C, 0xDD, 0xC1, 0x0A, 0x41, 0x91, 0x46, 0x27, 0xDF, 0x40, 0x40, 0xFD, 0x07,
+  0x23, 0xC4, 0x8E, 0x60, 0x0E, 0x40, 0x07, 0x25, 0xFF, 0xC1, 0xA0, 0x9B, 0x9E, 0x79, 0x2E, 0x40, 0x40, 0xFF, 0x14, 0x40, 0x36, 0x31, 0x67, 0x90,
+  0x19, 0x2F, 0xFF, 0x45, 0x19, 0x64, 0x60, 0x02, 0x4F, 0xF0, 0x1A, 0xFF, 0x5E, 0x60, 0x03, 0x83, 0x54, 0x40, 0x36, 0xF0, 0xBF, 0x00, 0x83, 0x5C,
+  0x40, 0x00, 0xE2, 0x12, 0x40, 0x40, 0xE9, 0x10, 0x01, 0x41, 0x14, 0xC1, 0x90, 0xEC, 0xC4, 0x70, 0x00, 0x9C, 0x35, 0x11, 0x11, 0xC0, 0xD8, 0x1D,
+  0xC0, 0x36, 0x22, 0xFB, 0xC0, 0xA8, 0xC0, 0x3F, 0x0D, 0xE6, 0x00, 0x40, 0x14, 0x21, 0xF5, 0x40, 0xD3, 0x40, 0x5F, 0x51, 0xA0, 0x8C, 0x90, 0x41,
+  0x20, 0xC2, 0x45, 0x2B, 0x40, 0xF9, 0x1D, 0x0B, 0xC1, 0x2C, 0xC2, 0xDC, 0x8F, 0xFB, 0x20, 0xD1, 0xFC, 0x34, 0x43, 0x55, 0xC1, 0xC2, 0x53, 0x31,
+  0x61, 0xF0, 0x00, 0xEF, 0xD4, 0x8E, 0x30, 0x33, 0x01, 0x40, 0x4A, 0x37, 0xC6, 0xEF, 0xF0, 0x00, 0xC6, 0xA2, 0x0D, 0x41, 0xC3, 0xA0, 0x3D, 0xFD,
+  0x42, 0x11, 0xC1, 0x31, 0xE0, 0xD0, 0x08, 0xC6, 0x24, 0xDB, 0x31, 0xE0, 0x1D, 0xC1, 0x3D, 0x44, 0x23, 0xC0, 0xB6, 0x70, 0xFF, 0x00, 0xE0, 0x40,
+  0x40, 0xD5, 0x21, 0x41, 0xA0, 0xEF, 0x7C, 0xCC, 0x0B, 0x40, 0x08, 0x40, 0x80, 0xED, 0x23, 0x7F, 0xEA, 0xD2, 0x80, 0xBF, 0x60, 0x20, 0x60, 0x1D,
+  0xC2, 0xF9, 0xE1, 0x01, 0x41, 0x04, 0x41, 0x90, 0xC6, 0x23, 0xDE, 0xD2, 0xFF, 0x80, 0x4F, 0x95, 0x40, 0x14, 0xA0, 0x75, 0x81, 0x6D, 0x75, 0x14,
+  0xC1, 0xAF, 0x43, 0x01, 0x41, 0xC2, 0xE0, 0x01, 0x41, 0x7B, 0x80, 0xC3, 0x1F, 0x41, 0xF0, 0x00, 0x33, 0x63, 0x0B, 0xC1, 0x7B, 0x34, 0xE3, 0x01,
+  0x41, 0x30, 0x33, 0xA0, 0x41, 0x29, 0xC1, 0xAB, 0x80, 0x12, 0x17, 0xC2, 0x6C, 0x17, 0xE6, 0x65, 0x17, 0xC1, 0x40, 0xF1, 0x06, 0x17, 0xC5, 0x16,
+  0x43, 0x2C, 0xC1, 0x80, 0xC3, 0x40, 0x36, 0x8F, 0xE6, 0x00, 0xC6, 0x24, 0x37, 0x41, 0x1A, 0xCB, 0x32, 0xC1, 0xF0, 0xDF, 0x00, 0x37, 0xC6, 0xA0,
+  0x2E, 0x13, 0x40, 0x66, 0xA0, 0xFF, 0x31, 0x82, 0x92, 0x0B, 0xB8, 0x60, 0x03, 0x47, 0xFF, 0xF4, 0x23, 0xE0, 0xD2, 0x80, 0x52, 0x08, 0x60, 0x9F,
+  0x05, 0x98, 0x03, 0x82, 0x92, 0x01, 0xC0, 0x04, 0x49, 0x23, 0x6A, 0x10, 0x40, 0xE4, 0x10, 0x42, 0x65, 0x01, 0x41, 0x35, 0x64, 0x01, 0x42, 0x7D,
+  0xE5, 0x23, 0xC2, 0x66, 0xA0, 0x4F, 0x91, 0x8E, 0x65, 0xC3, 0x0F, 0x33, 0x66, 0xA0, 0x24, 0x0E, 0xC3, 0x05, 0xC0, 0x0E, 0xC0, 0x6A, 0x42, 0xF9,
+  0x05, 0x17, 0xC3, 0x04, 0x47, 0x9B, 0xF7, 0x0D, 0x94, 0x60, 0xF7, 0x0D, 0xA0, 0x2B, 0x9D, 0x42, 0xF5, 0xF0, 0x00, 0x24, 0xDF, 0xE6, 0xA0, 0x44,
+  0x9F, 0xBE, 0x10, 0x43, 0x34, 0xE6, 0xAB, 0xA0, 0x19, 0x10, 0x62, 0x97, 0x10, 0x40, 0x20, 0x10, 0x43, 0x40, 0xFF, 0x14, 0x23, 0xE1, 0xA0, 0x39,
+  0xC2, 0x63, 0x25, 0xFD, 0x62, 0x10, 0x41, 0x24, 0x65, 0x90, 0x07, 0xC2, 0xA3, 0xF3, 0x25, 0xE6, 0x6D, 0x40, 0xB3, 0xC0, 0x90, 0x02, 0x83, 0x77,
+  0x7E, 0x16, 0x41, 0x25, 0x60, 0x23, 0xE0, 0xEB, 0xC0, 0xD3, 0x42, 0x15, 0x32, 0x5B, 0x40, 0x30, 0x0A, 0x41, 0x21, 0x77, 0xC0, 0x0A, 0x43, 0x11,
+  0xC1, 0xAF, 0x93, 0xF9, 0x90, 0x40, 0x13, 0x40, 0xFA, 0x05, 0xC1, 0xAF, 0xD5, 0x0F, 0x11, 0xC0, 0x62, 0x1A, 0xC1, 0x32, 0x5E, 0x42, 0x32, 0xE1,
+  0xFE, 0xC4, 0x41, 0x23, 0xED, 0xD2, 0x80, 0xB8, 0x68, 0x22, 0x62, 0x04, 0x42, 0x22, 0x62, 0xC6, 0x01, 0x40, 0x62, 0xC0, 0xA9, 0x88, 0x19, 0x41,
+  0xFF, 0xAB, 0xF8, 0x23, 0xE4, 0xD2, 0x80, 0x46, 0x43, 0xBF, 0x21, 0x42, 0xA0, 0x21, 0xA0, 0x98, 0x34, 0x43, 0x23, 0x65, 0xE7, 0x08, 0xC2, 0xC6,
+  0x6D, 0x40, 0xAF, 0x46, 0xDC, 0x09, 0x04, 0x40, 0xDF, 0xCE, 0xD0, 0x80, 0x47, 0xE5, 0x04, 0x41, 0x40, 0x16, 0xFF, 0x20, 0xD3, 0xA0, 0x19, 0x83,
+  0x5D, 0x20, 0x52, 0x7E, 0x70, 0x40, 0xF5, 0x21, 0x54, 0x98, 0x07, 0xC2, 0x9A, 0x40, 0x29, 0x90, 0xA9, 0x40, 0x01, 0x40, 0x05, 0x85, 0x42, 0x02,
+  0x04, 0x41, 0x0E, 0xC3, 0x6F, 0xD4, 0x09, 0x82, 0x64, 0x11, 0xC9, 0x31, 0x51, 0x8F, 0xC2, 0xDF, 0xD2, 0xD0, 0x08, 0x0D, 0xEF, 0x37, 0x40, 0x0D,
+  0x9E, 0xF3, 0x79, 0x20, 0xCE, 0xC0, 0x8B, 0x40, 0x45, 0xF0, 0x00, 0x9F, 0xF5, 0xBC, 0xAC, 0x41, 0x91, 0xC1, 0x40, 0xD0, 0x09, 0x26, 0x44, 0xBF,
+  0x27, 0x2D, 0xD5, 0x80, 0x91, 0x86, 0x0E, 0xC3, 0x27, 0xFB, 0x32, 0xD5, 0x52, 0x42, 0xAF, 0x67, 0x2F, 0x41, 0x27, 0xDB, 0x36, 0xD0, 0x02, 0xC0,
+  0x29, 0x15, 0x29, 0xC1, 0x3B, 0x9B, 0x36, 0x01, 0x41, 0x28, 0x88, 0x04, 0x41, 0x28, 0xDD, 0x01, 0x41, 0x0E, 0xC0, 0xEE, 0x3E, 0xC0, 0x16, 0xC3,
+  0x60, 0x01, 0x40, 0x00, 0x9A, 0x60, 0xFE, 0x0E, 0xC0, 0x02, 0xE3, 0x60, 0x00, 0x10, 0x00, 0x04, 0x6D, 0xF4, 0x01, 0x41, 0x06, 0xFF, 0x01, 0x41,
+  0x09, 0x07, 0x01, 0x41, 0xDB, 0x0B, 0x10, 0x01, 0x41, 0x0D, 0x1F, 0x01, 0x41, 0x0F, 0x65, 0x00, 0x01, 0x47, 0x04, 0x43, 0x07, 0x43, 0x0A, 0x43,
+  0x0D, 0x43, 0x10, 0x43, 0x13, 0x43, 0x16, 0x43, 0xD9, 0x10, 0x26, 0xC2, 0x01, 0x43, 0x16, 0xD3, 0x1C, 0x41, 0xFF, 0x93, 0xB6, 0x05, 0xC1, 0xFE,
+  0x37, 0x08, 0xC1, 0xFD, 0xD9, 0x01, 0x41, 0xFE, 0xAD, 0x9F, 0x01, 0x41, 0x03, 0x85, 0x16, 0x42, 0x6B, 0x01, 0x41, 0x16, 0x0D, 0x84, 0x01, 0x41,
+  0x1E, 0x49, 0x01, 0x47, 0x04, 0x43, 0x07, 0x43, 0x0A, 0x43, 0xA0, 0x0D, 0x43, 0x10, 0x44, 0x13, 0x42, 0x16, 0x43, 0x1C, 0x4A, 0xE3, 0x38, 0xC2,
+  0x64, 0x56, 0x05, 0xC1, 0xFF, 0xA8, 0x08, 0xC2, 0xA6, 0x01, 0x42, 0xDF, 0x28, 0x42, 0xAD, 0x01, 0x01, 0x41, 0x01, 0x28, 0x01, 0x42, 0x2F, 0x13,
+  0x42, 0x23, 0xAA, 0x01, 0x42, 0xA1, 0x19, 0x42, 0x89, 0x32, 0xC2, 0x54, 0x17, 0xC2, 0x7D, 0xDA, 0x0B, 0xC2, 0x8C, 0x01, 0x41, 0xFB, 0xE1, 0x01,
+  0x41, 0xF9, 0x42, 0xB6, 0x01, 0x41, 0x0C, 0x47, 0x01, 0x41, 0x0E, 0xA2, 0x01, 0x41, 0xEC, 0x6D, 0x43, 0x01, 0x41, 0xEA, 0xCE, 0x01, 0x41, 0x17,
+  0x46, 0x01, 0x47, 0x00, 0x04, 0x43, 0x07, 0x43, 0x0A, 0x43, 0x0D, 0x43, 0x10, 0x43, 0x13, 0x43, 0x16, 0x43, 0x19, 0x43, 0x00, 0x1C, 0x43, 0x1F,
+  0x43, 0x22, 0x43, 0x25, 0x43, 0x28, 0x43, 0x2B, 0x43, 0x2E, 0x43, 0x31, 0x43, 0xB0, 0x34, 0x44, 0x37, 0x42, 0x3A, 0x43, 0x40, 0x49, 0x17, 0x0B,
+  0x40, 0x42, 0x03, 0x56, 0x05, 0xC1, 0x54, 0xC0, 0x08, 0xC2, 0x05, 0x01, 0x48, 0x0F, 0x01, 0x47, 0x6D, 0x09, 0x07, 0x42, 0x0A, 0x20, 0x01, 0x41,
+  0x1D, 0x40, 0x5E, 0x42, 0x01, 0x60, 0x13, 0x4D, 0x8E, 0x41
 };
 
-const size_t PatchSize102 = sizeof(PatchByteValues102);
+const size_t PatchSize102 = 6108;
+const size_t PatchPackedSize102 = sizeof(PatchByteValues102);
+const uint32_t PatchCrc102 = 0xC3E2E1FD;
 const unsigned char * pPatchBytes102 = &PatchByteValues102[0];
 
 extern const size_t LutSize102;
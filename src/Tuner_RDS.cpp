@@ -0,0 +1,88 @@
+#include "TEF6686.h"
+
+tunerrdsstats_ tunerrdsstats;
+
+static TunerRing<tunergroup_, TUNER_RDS_GROUPS> rdsqueue;
+static std::atomic<uint16_t> rdsstatus(0);
+static unsigned long rdslastpoll = 0;
+static uint16_t rdsgap = 0;
+static std::atomic<bool> rdspollnow(false);                               // Set by TunerRDS_Flush(), taken by the producer
+static std::atomic<bool> rdsresetstats(false);                            // Set by TunerRDS_ResetStats(), taken by the producer
+static tunergroup_ rdslast;                                               // Producer side, for duplicate detection
+static uint32_t rdsflushseq = 0;                                          // Consumer side
+
+void TunerRDS_Poll() {
+  tunergroup_ burst[TUNER_RDS_BURST];
+  uint8_t count = 0;
+  uint16_t status;
+
+  if (rdsresetstats.exchange(false)) {
+    tunerrdsstats.received = 0;
+    tunerrdsstats.duplicate = 0;
+    tunerrdsstats.overflow = 0;
+    tunerrdsstats.errored = 0;
+    tunerrdsstats.dropped = 0;
+    tunerrdsstats.polls = 0;
+  }
+  if (!rdspollnow.exchange(false) && millis() - rdslastpoll < rdsgap) return;
+  rdslastpoll = millis();
+  tunerrdsstats.polls++;
+
+  // Each read hands over the oldest unread group, bit 15 set means it is new
+  while (count < TUNER_RDS_BURST) {
+    tunergroup_ &group = burst[count];
+    if (!devTEF_Radio_Get_RDS_Data(&group.status, &group.blockA, &group.blockB, &group.blockC, &group.blockD, &group.error)) break;
+    status = group.status;
+    rdsstatus.store(status, std::memory_order_relaxed);
+    if (!bitRead(status, 15)) break;
+    if (bitRead(status, 14)) tunerrdsstats.overflow++;
+    count++;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    tunergroup_ &group = burst[i];
+    group.timestamp = rdslastpoll - (count - 1 - i) * TUNER_RDS_GROUP_MS;   // Older groups waited in the chip
+    group.seq = TunerTask_Executed();
+    tunerrdsstats.received++;
+    if (group.error & 0xaa00) tunerrdsstats.errored++;                   // Any block with error class 2 or 3
+    if (group.blockA == rdslast.blockA && group.blockB == rdslast.blockB && group.blockC == rdslast.blockC && group.blockD == rdslast.blockD) tunerrdsstats.duplicate++;
+    rdslast = group;
+    if (!rdsqueue.push(group)) tunerrdsstats.dropped++;
+  }
+
+  if (count) rdsgap = TUNER_RDS_LOCKED_MS;
+  else rdsgap = bitRead(rdsstatus.load(std::memory_order_relaxed), 9) ? TUNER_RDS_HUNT_MS : TUNER_RDS_IDLE_MS;
+}
+
+bool TunerRDS_Get(tunergroup_ &group) {
+  while (rdsqueue.pop(group)) {
+    if ((int32_t)(group.seq - rdsflushseq) >= 0) return true;
+    tunerrdsstats.flushed++;
+  }
+  return false;
+}
+
+uint16_t TunerRDS_Status() {
+  return rdsstatus.load(std::memory_order_relaxed);
+}
+
+uint8_t TunerRDS_Pending() {
+  return rdsqueue.size();
+}
+
+// Forget queued groups, including any the tuner task reads before the
+// commands queued so far (a retune) have reached the chip. The producer
+// owns the poll timing, so it is only asked to poll again at once.
+void TunerRDS_Flush() {
+  tunergroup_ group;
+  rdsflushseq = TunerTask_Submitted();
+  while (rdsqueue.pop(group)) tunerrdsstats.flushed++;
+  rdspollnow.store(true);
+}
+
+// flushed belongs to the consumer and is cleared here, the producer
+// clears its own counters on its next poll
+void TunerRDS_ResetStats() {
+  tunerrdsstats.flushed = 0;
+  rdsresetstats.store(true);
+}
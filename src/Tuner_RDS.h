@@ -0,0 +1,48 @@
+#ifndef TUNER_RDS_H
+#define TUNER_RDS_H
+
+#include <stdint.h>
+
+#define TUNER_RDS_GROUPS            32                                    // Queued groups, ~2.8 s of RDS
+#define TUNER_RDS_BURST             8                                     // FIFO reads per poll at most
+#define TUNER_RDS_GROUP_MS          88                                    // One group at 1187.5 bit/s
+#define TUNER_RDS_LOCKED_MS         70                                    // Next poll after a group arrived
+#define TUNER_RDS_HUNT_MS           8                                     // Synced but the next group is late
+#define TUNER_RDS_IDLE_MS           40                                    // No RDS sync
+
+typedef struct _tunergroup_ {
+  uint32_t timestamp;                                                     // millis() the group left the chip
+  uint32_t seq;                                                           // Tuner commands executed before it was read
+  uint16_t status;
+  uint16_t blockA;
+  uint16_t blockB;
+  uint16_t blockC;
+  uint16_t blockD;
+  uint16_t error;
+} tunergroup_;
+
+// Every counter has one writer: flushed is counted by the consumer, the
+// rest by the producer in TunerRDS_Poll()
+typedef struct _tunerrdsstats_ {
+  uint32_t received;
+  uint32_t duplicate;                                                     // Same four blocks as the group before
+  uint32_t overflow;                                                      // Chip reported lost data
+  uint32_t errored;                                                       // At least one uncorrectable block
+  uint32_t dropped;                                                       // Queue full
+  uint32_t flushed;                                                       // Discarded on retune
+  uint32_t polls;
+} tunerrdsstats_;
+
+extern tunerrdsstats_ tunerrdsstats;
+
+// RDS acquisition: drains the chip buffer into a timestamped queue. The
+// poll interval follows the group clock, so a group is normally picked
+// up within a few ms of arriving. TunerRDS_Poll() runs in the tuner task
+// when it is started and from TEF6686::readRDS() otherwise.
+void TunerRDS_Poll();
+bool TunerRDS_Get(tunergroup_ &group);
+uint16_t TunerRDS_Status();
+uint8_t TunerRDS_Pending();
+void TunerRDS_Flush();
+void TunerRDS_ResetStats();
+#endif
@@ -0,0 +1,283 @@
+#ifdef TUNER_HOST_BUILD
+#include "Tuner_Sim.h"
+
+#define SimConvert8bto16b(a) ((uint16_t)(((uint16_t)(*(a))) << 8 |((uint16_t)(*(a+1)))))
+
+static void SimPut16(uint8_t *buf, uint16_t len, uint16_t pos, uint16_t value) {
+  if (pos + 1 < len) {
+    buf[pos] = (uint8_t)(value >> 8);
+    buf[pos + 1] = (uint8_t)value;
+  }
+}
+
+TEF668xSim::TEF668xSim() {
+  stations = 0;
+  reset();
+}
+
+void TEF668xSim::reset() {
+  frequency = 10000;
+  measured = frequency;
+  tunes = 0;
+  rdsdelivered = 0;
+  rdslost = 0;
+  naks = 0;
+  opstatus = 0;
+  volume = 0;
+  mute = false;
+  am = false;
+  tunemode = 1;
+  tunetime = micros();
+  nextgroup = tunetime;
+  busyuntil = tunetime;
+  request[0] = 0;
+  request[1] = 0;
+  clearRDS();
+}
+
+bool TEF668xSim::addStation(uint16_t frequency, int16_t level, uint16_t usn, uint16_t wam, int16_t offset, uint16_t pi) {
+  if (stations == TEF_SIM_STATIONS) return false;
+  station[stations].frequency = frequency;
+  station[stations].level = level;
+  station[stations].usn = usn;
+  station[stations].wam = wam;
+  station[stations].offset = offset;
+  station[stations].pi = pi;
+  stations++;
+  return true;
+}
+
+// Changes the reception of a station, e.g. to let it fade while tuned
+bool TEF668xSim::setStation(uint16_t frequency, int16_t level, uint16_t usn, uint16_t wam) {
+  for (uint8_t i = 0; i < stations; i++) {
+    if (station[i].frequency != frequency) continue;
+    station[i].level = level;
+    station[i].usn = usn;
+    station[i].wam = wam;
+    return true;
+  }
+  return false;
+}
+
+bool TEF668xSim::queueRDS(uint16_t blockA, uint16_t blockB, uint16_t blockC, uint16_t blockD, uint16_t error) {
+  if (queuecount == TEF_SIM_RDS_QUEUE) return false;
+  simgroup_ &group = queue[(queuehead + queuecount) % TEF_SIM_RDS_QUEUE];
+  group.blockA = blockA;
+  group.blockB = blockB;
+  group.blockC = blockC;
+  group.blockD = blockD;
+  group.error = error;
+  queuecount++;
+  return true;
+}
+
+void TEF668xSim::clearRDS() {
+  queuehead = 0;
+  queuecount = 0;
+  fifohead = 0;
+  fifocount = 0;
+  overflow = false;
+  memset(&lastgroup, 0, sizeof(lastgroup));
+}
+
+const simstation_ *TEF668xSim::findStation(uint16_t freq) {
+  if (am) return NULL;
+  for (uint8_t i = 0; i < stations; i++) {
+    if (station[i].frequency == freq) return &station[i];
+  }
+  return NULL;
+}
+
+uint32_t TEF668xSim::settleTime() {
+  switch (tunemode) {
+    case 3: return 1000;                                                  // AF update: 1 ms quality snapshot
+    case 2: return 5000;                                                  // Search
+    default: return 32000;                                                // Preset, jump, check
+  }
+}
+
+uint16_t TEF668xSim::qualityStatus() {
+  uint32_t timer = (micros() - tunetime) / 100;                           // 0.1 ms since tuning, 1000 means 100 ms or more
+  uint16_t status = timer > 1000 ? 1000 : timer;
+  if (tunemode == 3) status |= (1 << 15);
+  return status;
+}
+
+void TEF668xSim::pumpRDS() {
+  const simstation_ *tuned = findStation(frequency);
+  uint32_t now = micros();
+
+  if (tuned == NULL || tuned->pi == 0 || (now - tunetime) < settleTime()) {
+    nextgroup = now + TEF_SIM_GROUP_US;
+    return;
+  }
+
+  while ((int32_t)(now - nextgroup) >= 0 && queuecount) {
+    if (fifocount == TEF_SIM_RDS_FIFO) {
+      fifohead = (fifohead + 1) % TEF_SIM_RDS_FIFO;
+      fifocount--;
+      overflow = true;
+      rdslost++;
+    }
+    fifo[(fifohead + fifocount) % TEF_SIM_RDS_FIFO] = queue[queuehead];
+    fifocount++;
+    queuehead = (queuehead + 1) % TEF_SIM_RDS_QUEUE;
+    queuecount--;
+    nextgroup += TEF_SIM_GROUP_US;
+  }
+  if (queuecount == 0 && (int32_t)(now - nextgroup) > 0) nextgroup = now;
+}
+
+bool TEF668xSim::busy() {
+  if ((int32_t)(micros() - busyuntil) < 0) {
+    naks++;
+    return true;
+  }
+  return false;
+}
+
+bool TEF668xSim::write(const uint8_t *buf, uint16_t len) {
+  if (len == 0 || busy()) return false;
+  busyuntil = micros() + TEF_SIM_BUSY_US;
+
+  switch (buf[0]) {
+    case 0x1e:                                                            // Reset
+      opstatus = 0;
+      return true;
+
+    case 0x1b:                                                            // Patch/LUT data
+      return true;
+
+    case 0x1c:                                                            // Patch control, boot state holds until the start command
+      return true;
+
+    case 0x14:                                                            // Start after patch
+      opstatus = 1;
+      return true;
+  }
+
+  if (len < 3) return false;
+  uint8_t module = buf[0];
+  uint8_t cmd = buf[1];
+
+  if (cmd >= 128) {                                                       // Getter, answered by the next read
+    request[0] = module;
+    request[1] = cmd;
+    return true;
+  }
+
+  uint16_t param1 = len >= 5 ? SimConvert8bto16b(buf + 3) : 0;
+  uint16_t param2 = len >= 7 ? SimConvert8bto16b(buf + 5) : 0;
+
+  switch (module) {
+    case TEF_FM:
+    case TEF_AM:
+      if (cmd == Cmd_Tune_To && param1 != 0) {
+        bool newam = (module == TEF_AM);
+        if (param1 != 3 && (newam != am || param2 != frequency)) {
+          fifohead = 0;
+          fifocount = 0;
+          overflow = false;
+          memset(&lastgroup, 0, sizeof(lastgroup));
+        }
+        am = newam;
+        measured = param2;
+        if (param1 != 3) frequency = param2;                              // AF update returns to the tuned channel
+        tunemode = param1;
+        tunetime = micros();
+        busyuntil = tunetime + TEF_SIM_BUSY_TUNE_US;
+        nextgroup = tunetime + TEF_SIM_GROUP_US;
+        tunes++;
+      }
+      break;
+
+    case TEF_AUDIO:
+      if (cmd == Cmd_Set_Mute) mute = param1;
+      if (cmd == Cmd_Set_Volume) volume = param1;
+      break;
+
+    case TEF_APPL:
+      if (cmd == Cmd_Set_OperationMode) opstatus = param1 ? 1 : 2;
+      break;
+  }
+  return true;
+}
+
+void TEF668xSim::answer(uint8_t *buf, uint16_t len) {
+  const simstation_ *tuned = findStation(frequency);
+  const simstation_ *quality = findStation(measured);
+  memset(buf, 0, len);
+
+  switch (request[1]) {
+    case Cmd_Get_Quality_Status:
+    case Cmd_Get_Quality_Data:
+      if (request[0] == TEF_APPL) break;
+      SimPut16(buf, len, 0, qualityStatus());
+      if (micros() - tunetime >= TEF_SIM_LEVEL_US) SimPut16(buf, len, 2, quality ? quality->level : 80);
+      if (micros() - tunetime >= settleTime()) {
+        SimPut16(buf, len, 4, quality ? quality->usn : 450);
+        SimPut16(buf, len, 6, quality ? quality->wam : 350);
+        SimPut16(buf, len, 8, quality ? quality->offset : 0);
+      } else {
+        SimPut16(buf, len, 4, 1000);                                      // Not measured yet, reads as noise
+        SimPut16(buf, len, 6, 1000);
+      }
+      SimPut16(buf, len, 10, 2360);
+      SimPut16(buf, len, 12, quality ? 750 : 50);
+      break;
+
+    case Cmd_Get_RDS_Status:
+    case Cmd_Get_RDS_Data: {
+        if (request[0] != TEF_FM) break;
+        pumpRDS();
+        uint16_t status = (tuned && tuned->pi && (micros() - tunetime) >= settleTime()) ? (1 << 9) : 0;
+        if (request[1] == Cmd_Get_RDS_Data && fifocount) {
+          lastgroup = fifo[fifohead];
+          fifohead = (fifohead + 1) % TEF_SIM_RDS_FIFO;
+          fifocount--;
+          rdsdelivered++;
+          status |= (1 << 15);
+          if (overflow) status |= (1 << 14);                              // Data loss, a group was overwritten
+          overflow = false;
+        } else if (request[1] == Cmd_Get_RDS_Status && tuned && tuned->pi) {
+          lastgroup.blockA = tuned->pi;
+        }
+        SimPut16(buf, len, 0, status);
+        SimPut16(buf, len, 2, lastgroup.blockA);
+        SimPut16(buf, len, 4, lastgroup.blockB);
+        SimPut16(buf, len, 6, lastgroup.blockC);
+        SimPut16(buf, len, 8, lastgroup.blockD);
+        SimPut16(buf, len, 10, lastgroup.error);
+      }
+      break;
+
+    case Cmd_Get_Signal_Status:
+      SimPut16(buf, len, 0, (tuned && tuned->level > 300) ? (1 << 15) : 0);
+      break;
+
+    case Cmd_Get_Processing_Status:
+      SimPut16(buf, len, 2, 1000);
+      break;
+  }
+
+  if (request[0] == TEF_APPL) {
+    switch (request[1]) {
+      case Cmd_Get_Operation_Status:
+        SimPut16(buf, len, 0, opstatus);
+        break;
+
+      case Cmd_Get_Identification:
+        SimPut16(buf, len, 0, 0x0901);
+        SimPut16(buf, len, 2, 0x0201);
+        SimPut16(buf, len, 4, 0x0501);
+        break;
+    }
+  }
+}
+
+bool TEF668xSim::read(uint8_t *buf, uint16_t len) {
+  if (request[0] == 0 || busy()) return false;
+  answer(buf, len);
+  return true;
+}
+#endif
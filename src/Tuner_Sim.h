@@ -0,0 +1,85 @@
+#ifndef TUNER_SIM_H
+#define TUNER_SIM_H
+
+#include "TEF6686.h"
+
+#define TEF_SIM_STATIONS            32
+#define TEF_SIM_RDS_QUEUE           64
+#define TEF_SIM_RDS_FIFO            1                                     // The chip holds one unread group
+#define TEF_SIM_GROUP_US            87600                                 // One RDS group at 1187.5 bit/s
+#define TEF_SIM_BUSY_US             60                                    // Command processing, NAK while busy
+#define TEF_SIM_BUSY_TUNE_US        250
+#define TEF_SIM_LEVEL_US            1000                                  // Level measured, USN and WAM take the mode's settle time
+
+typedef struct _simstation_ {
+  uint16_t frequency;                                                     // 10 kHz units for FM, kHz for AM
+  int16_t level;                                                          // 0.1 dBuV
+  uint16_t usn;
+  uint16_t wam;
+  int16_t offset;
+  uint16_t pi;
+} simstation_;
+
+typedef struct _simgroup_ {
+  uint16_t blockA;
+  uint16_t blockB;
+  uint16_t blockC;
+  uint16_t blockD;
+  uint16_t error;
+} simgroup_;
+
+// Behavioural model of a TEF668x seen from the I2C side. It answers the
+// commands used by TEF6686/Tuner_Drv_Lithio with plausible timing: the
+// quality timestamp counts from the tune command, the level is measured
+// after TEF_SIM_LEVEL_US, USN and WAM only after a mode dependent settle time,
+// and RDS groups arrive at the real group rate from a scripted queue into a
+// small chip FIFO.
+class TEF668xSim : public TunerBus {
+  public:
+    TEF668xSim();
+    bool write(const uint8_t *buf, uint16_t len);
+    bool read(uint8_t *buf, uint16_t len);
+
+    void reset();
+    bool addStation(uint16_t frequency, int16_t level, uint16_t usn, uint16_t wam, int16_t offset, uint16_t pi);
+    bool setStation(uint16_t frequency, int16_t level, uint16_t usn, uint16_t wam);
+    bool queueRDS(uint16_t blockA, uint16_t blockB, uint16_t blockC, uint16_t blockD, uint16_t error);
+    void clearRDS();
+
+    uint16_t frequency;
+    uint16_t tunes;
+    uint16_t rdsdelivered;
+    uint16_t rdslost;
+    uint16_t naks;
+    uint8_t opstatus;
+    uint16_t volume;
+    bool mute;
+
+  private:
+    bool busy();
+    const simstation_ *findStation(uint16_t freq);
+    uint32_t settleTime();
+    uint16_t qualityStatus();
+    void pumpRDS();
+    void answer(uint8_t *buf, uint16_t len);
+
+    simstation_ station[TEF_SIM_STATIONS];
+    uint8_t stations;
+    simgroup_ queue[TEF_SIM_RDS_QUEUE];
+    uint8_t queuehead;
+    uint8_t queuecount;
+    simgroup_ fifo[TEF_SIM_RDS_FIFO];
+    uint8_t fifohead;
+    uint8_t fifocount;
+    simgroup_ lastgroup;
+    bool overflow;
+    bool am;
+    uint16_t measured;
+    uint8_t tunemode;
+    uint32_t tunetime;
+    uint32_t nextgroup;
+    uint32_t busyuntil;
+    uint8_t request[2];
+};
+
+#endif
@@ -0,0 +1,142 @@
+#include "TEF6686.h"
+
+tunertaskstats_ tunertaskstats;
+
+static TaskHandle_t tunerworker = NULL;
+static SemaphoreHandle_t tunerlock = NULL;
+static TunerRing<tunercmd_, TUNER_TASK_COMMANDS> tunercommands;
+static TunerLatest<tunersample_> tunersamples;
+static std::atomic<uint32_t> tunerexecuted(0);
+static std::atomic<bool> tunersampleam(false);
+static uint32_t tunersubmitted = 0;                                       // loop() side only
+static unsigned long tunerdirect = 0;                                     // Last write loop() made past the ring
+static tunersample_ tunerlatest;                                          // loop() side only
+
+static bool TunerTask_InWorker() {
+  return xTaskGetCurrentTaskHandle() == tunerworker;
+}
+
+static void TunerTask_Sample() {
+  tunersample_ sample;
+  bool r;
+
+  sample.seq = tunerexecuted.load(std::memory_order_acquire);
+  sample.am = tunersampleam.load(std::memory_order_relaxed);
+  if (sample.am) {
+    r = devTEF_Radio_Get_Quality_Status_AM(&sample.status, &sample.level, &sample.usn, &sample.wam, &sample.offset, &sample.bandwidth, &sample.modulation, &sample.snr);
+  } else {
+    r = devTEF_Radio_Get_Quality_Status(&sample.status, &sample.level, &sample.usn, &sample.wam, &sample.offset, &sample.bandwidth, &sample.modulation, &sample.snr);
+  }
+  sample.timestamp = millis();
+  if (!r) return;
+  tunersamples.publish(sample);
+  tunertaskstats.samples++;
+}
+
+static void TunerTask_Run(void *arg) {
+  tunercmd_ cmd;
+  unsigned long lastquality = 0;
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5));
+
+    TunerTask_Lock();
+    while (tunercommands.pop(cmd)) {
+      if (!Tuner_WriteBuffer(cmd.data, cmd.len)) tunertaskstats.failed++;
+      tunerexecuted.fetch_add(1, std::memory_order_release);
+      tunertaskstats.executed++;
+    }
+    TunerTask_Unlock();
+
+    if (millis() - lastquality >= TUNER_TASK_QUALITY_MS) {
+      lastquality = millis();
+      TunerTask_Sample();
+    }
+
+    if (!tunersampleam.load(std::memory_order_relaxed)) TunerRDS_Poll();
+  }
+}
+
+bool TunerTask_Begin() {
+  if (tunerworker != NULL) return true;
+  tunerlock = xSemaphoreCreateRecursiveMutex();
+  if (tunerlock == NULL) return false;
+  memset(&tunertaskstats, 0, sizeof(tunertaskstats));
+  memset(&tunerlatest, 0, sizeof(tunerlatest));
+  return xTaskCreatePinnedToCore(TunerTask_Run, "tuner", TUNER_TASK_STACK, NULL, TUNER_TASK_PRIORITY, &tunerworker, TUNER_TASK_CORE) == pdPASS;
+}
+
+bool TunerTask_Running() {
+  return tunerworker != NULL;
+}
+
+bool TunerTask_Queue(const unsigned char *buf, uint16_t len) {
+  if (tunerworker == NULL || TunerTask_InWorker()) return false;
+  if (len > TUNER_TASK_FRAME || xSemaphoreGetMutexHolder(tunerlock) == xTaskGetCurrentTaskHandle()) {
+    tunerdirect = millis();
+    return false;
+  }
+
+  tunercmd_ cmd;
+  cmd.len = len;
+  memcpy(cmd.data, buf, len);
+  while (!tunercommands.push(cmd)) {
+    tunertaskstats.waits++;
+    xTaskNotifyGive(tunerworker);
+    vTaskDelay(1);
+  }
+  tunersubmitted++;
+  tunertaskstats.queued++;
+  xTaskNotifyGive(tunerworker);
+  return true;
+}
+
+// Recursive bus lock. Taken from loop() it first lets the worker drain the
+// command ring, so a getter always sees the effect of earlier writes.
+void TunerTask_Lock() {
+  if (tunerworker == NULL) return;
+  if (TunerTask_InWorker()) {
+    xSemaphoreTakeRecursive(tunerlock, portMAX_DELAY);
+    return;
+  }
+
+  for (;;) {
+    xSemaphoreTakeRecursive(tunerlock, portMAX_DELAY);
+    if (tunercommands.empty()) break;
+    xSemaphoreGiveRecursive(tunerlock);
+    xTaskNotifyGive(tunerworker);
+    vTaskDelay(1);
+  }
+  tunertaskstats.flushes++;
+}
+
+void TunerTask_Unlock() {
+  if (tunerworker != NULL) xSemaphoreGiveRecursive(tunerlock);
+}
+
+// Newest worker sample for the requested module, provided it was taken
+// after every write loop() has queued so far.
+bool TunerTask_GetQuality(tunersample_ &sample, bool am) {
+  if (tunerworker == NULL) return false;
+  tunersampleam.store(am, std::memory_order_relaxed);
+  tunersamples.take(tunerlatest);
+
+  if (tunerlatest.am != am || tunerlatest.seq != tunersubmitted || (long)(tunerlatest.timestamp - tunerdirect) <= 0 || millis() - tunerlatest.timestamp > TUNER_TASK_MAXAGE) {
+    tunertaskstats.fallbacks++;
+    return false;
+  }
+  sample = tunerlatest;
+  return true;
+}
+
+uint32_t TunerTask_Submitted() {
+  return tunersubmitted;
+}
+
+uint32_t TunerTask_Executed() {
+  return tunerexecuted.load(std::memory_order_acquire);
+}
+
+uint32_t TunerTask_Failed() {
+  return tunertaskstats.failed;
+}
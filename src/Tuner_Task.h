@@ -0,0 +1,126 @@
+#ifndef TUNER_TASK_H
+#define TUNER_TASK_H
+
+#include <stdint.h>
+#include <atomic>
+
+#define TUNER_TASK_CORE             0                                     // loop() runs on core 1
+#define TUNER_TASK_PRIORITY         2
+#define TUNER_TASK_STACK            3072
+#define TUNER_TASK_FRAME            16                                    // Longest queued write, longer ones go direct
+#define TUNER_TASK_COMMANDS         32
+#define TUNER_TASK_QUALITY_MS       20
+#define TUNER_TASK_MAXAGE           (2 * TUNER_TASK_QUALITY_MS)            // Older samples are read synchronously instead
+
+// Single producer, single consumer ring. head is only written by the
+// producer and tail only by the consumer, so neither side needs a lock.
+template <class T, uint16_t N>
+class TunerRing {
+    static_assert(N && (N & (N - 1)) == 0, "ring size must be a power of 2");
+
+  public:
+    TunerRing() : head(0), tail(0) {}
+
+    bool push(const T &item) {
+      uint16_t h = head.load(std::memory_order_relaxed);
+      if ((uint16_t)(h - tail.load(std::memory_order_acquire)) == N) return false;
+      slot[h & (N - 1)] = item;
+      head.store(h + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(T &item) {
+      uint16_t t = tail.load(std::memory_order_relaxed);
+      if (t == head.load(std::memory_order_acquire)) return false;
+      item = slot[t & (N - 1)];
+      tail.store(t + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool empty() {
+      return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+
+    uint16_t size() {
+      return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+  private:
+    T slot[N];
+    std::atomic<uint16_t> head;
+    std::atomic<uint16_t> tail;
+};
+
+// Single producer, single consumer latest value (triple buffer). The
+// producer never waits and the consumer always gets the newest value.
+template <class T>
+class TunerLatest {
+  public:
+    TunerLatest() : write(0), middle(1), read(2) {}
+
+    void publish(const T &item) {
+      slot[write] = item;
+      write = middle.exchange(write | FRESH, std::memory_order_acq_rel) & ~FRESH;
+    }
+
+    bool take(T &item) {
+      if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+      read = middle.exchange(read, std::memory_order_acq_rel) & ~FRESH;
+      item = slot[read];
+      return true;
+    }
+
+  private:
+    static const uint8_t FRESH = 4;
+    T slot[3];
+    uint8_t write;
+    std::atomic<uint8_t> middle;
+    uint8_t read;
+};
+
+typedef struct _tunercmd_ {
+  uint8_t len;
+  uint8_t data[TUNER_TASK_FRAME];
+} tunercmd_;
+
+typedef struct _tunersample_ {
+  uint32_t seq;                                                           // Commands executed before the sample was taken
+  uint32_t timestamp;
+  bool am;
+  uint16_t status;
+  int16_t level;
+  uint16_t usn;
+  uint16_t wam;
+  int16_t offset;
+  uint16_t bandwidth;
+  uint16_t modulation;
+  int8_t snr;
+} tunersample_;
+
+typedef struct _tunertaskstats_ {
+  uint32_t queued;
+  uint32_t executed;
+  uint32_t failed;                                                        // Queued writes the bus did not ACK
+  uint32_t waits;                                                         // Producer found the command ring full
+  uint32_t flushes;                                                       // Synchronous transactions from loop()
+  uint32_t samples;
+  uint32_t fallbacks;                                                     // Quality reads the worker could not answer
+} tunertaskstats_;
+
+extern tunertaskstats_ tunertaskstats;
+
+// Worker pinned to TUNER_TASK_CORE that owns the tuner bus once started.
+// Writes from loop() are queued, getters flush the queue and run under the
+// bus lock, quality is sampled and RDS polled (Tuner_RDS.h) by the worker.
+// Only loop() may submit commands. A queued write returns before it is
+// sent; TunerTask_Failed() counts the ones the worker could not deliver.
+bool TunerTask_Begin();
+bool TunerTask_Running();
+bool TunerTask_Queue(const unsigned char *buf, uint16_t len);
+void TunerTask_Lock();
+void TunerTask_Unlock();
+bool TunerTask_GetQuality(tunersample_ &sample, bool am);
+uint32_t TunerTask_Submitted();
+uint32_t TunerTask_Executed();
+uint32_t TunerTask_Failed();
+#endif
@@ -417,6 +417,43 @@ void Communication() {
   }
 }
 
+// XDR-GTK spectrum sweep. Each point is tuned in search mode and its
+// quality is taken from the settle poll, without a second read. Points
+// are collected in batches and written with one call per batch.
+static void XDRSweep() {
+  static int16_t level[XDR_SWEEP_BATCH];
+  static char out[XDR_SWEEP_BATCH * 16 + 1];
+  unsigned long start = millis();
+  unsigned int points = 0;
+
+  DataWrite("U", 1);
+  freq_scan = scanner_start;
+  while (freq_scan <= scanner_end && scanner_step) {
+    unsigned int first = freq_scan;
+    uint8_t count = 0;
+
+    for (; count < XDR_SWEEP_BATCH && freq_scan <= scanner_end; count++, freq_scan += scanner_step) {
+      radio.startTune(freq_scan, 2);                                      // Search mode, measures fastest
+      radio.waitTune();
+      if (band < BAND_GAP && radio.quality.valid) {
+        level[count] = radio.quality.level;
+      } else {
+        if (band < BAND_GAP) radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN); else radio.getStatusAM(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
+        level[count] = SStatus;
+      }
+    }
+
+    size_t length = 0;
+    for (uint8_t i = 0; i < count; i++) length += snprintf(out + length, sizeof(out) - length, "%u = %d, ", (first + i * scanner_step) * 10, (level[i] / 10) + 10);
+    DataWrite(out, length);
+    points += count;
+  }
+  DataWrite("\n", 1);
+
+  unsigned long elapsed = millis() - start;
+  log_d("XDR sweep: %u points in %lu ms, %lu points/s", points, elapsed, elapsed ? points * 1000UL / elapsed : 0);
+}
+
 void XDRGTKRoutine() {
   if (XDRGTKUSB) {
     while (Serial.available() > 0) {
@@ -672,6 +709,21 @@ void XDRGTKRoutine() {
         store = true;
         break;
 
+      case 'N': {
+          int8_t &seeklevel = band < BAND_GAP ? seeklevelfm : seeklevelam;
+          int8_t &seeksnr = band < BAND_GAP ? seeksnrfm : seeksnram;
+          char *snr = strchr(buff + 1, ',');
+          if (buff[1] != '\0' && buff[1] != ',') seeklevel = constrain(atol(buff + 1), -128, 127);
+          if (snr) seeksnr = constrain(atol(snr + 1), -128, 127);
+          if (buff[1] != '\0') {
+            EEPROM.writeByte(band < BAND_GAP ? EE_BYTE_SEEKLEVELFM : EE_BYTE_SEEKLEVELAM, seeklevel);
+            EEPROM.writeByte(band < BAND_GAP ? EE_BYTE_SEEKSNRFM : EE_BYTE_SEEKSNRAM, seeksnr);
+            EEPROM.commit();
+          }
+          DataPrint("N" + String((int)seeklevel) + "," + String((int)seeksnr) + "\n");
+          break;
+        }
+
       case 'T':
         if (scandxmode) cancelDXScan();
         unsigned int freqtemp;
@@ -838,19 +890,8 @@ void XDRGTKRoutine() {
               tftPrint(ACENTER, textUI(34), 160, 100, ActiveColor, ActiveColorSmooth, 28);
             }
 
-            DataPrint("U");
             frequencyold = frequency;
-
-            for (freq_scan = scanner_start; freq_scan <= scanner_end; freq_scan += scanner_step) {
-              radio.SetFreq(freq_scan);
-              delay(5);
-              DataPrint(String(freq_scan * 10, DEC));
-              DataPrint(" = ");
-              if (band < BAND_GAP) radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus, CN); else  radio.getStatusAM(SStatus, USN, WAM, OStatus, BW, MStatus, CN);
-              DataPrint(String((SStatus / 10) + 10, DEC));
-              DataPrint(", ");
-            }
-            DataPrint("\n");
+            XDRSweep();
 
             radio.SetFreq(frequencyold);
             BuildDisplay();
@@ -968,7 +1009,7 @@ void XDRGTKRoutine() {
     XDRGTKdata = false;
   }
 
-  if (millis() >= signalstatustimer + 66) {
+  if (millis() >= signalstatustimer + XDR_SIGNAL_INTERVAL) {
     if (band > BAND_GAP) {
       DataPrint("Sm");
     } else {
@@ -981,7 +1022,8 @@ void XDRGTKRoutine() {
       }
     }
 
-    DataPrint(String(((SStatus * 100) + 10875) / 1000) + "." + String(((SStatus * 100) + 10875) / 100 % 10) + "," + String(WAM / 10) + "," + String(USN / 10) + "," + String(BW) + "\n\n");
+    const quality_ &status = radio.getStatusIfOlderThan(XDR_SIGNAL_INTERVAL, band >= BAND_GAP);
+    DataPrint(String(((status.level * 100) + 10875) / 1000) + "." + String(((status.level * 100) + 10875) / 100 % 10) + "," + String(status.wam / 10) + "," + String(status.usn / 10) + "," + String(status.bandwidth) + "\n\n");
     signalstatustimer = millis();
   }
 }
@@ -1015,6 +1057,13 @@ void tryWiFi() {
       webserver.on("/custom_ptys.csv", HTTP_GET, handleDownloadCustomPTYS);
       webserver.on("/upload_custom_ptys", HTTP_GET, handleUploadCustomPTYSForm);
       webserver.on("/upload_custom_ptys", HTTP_POST, [](){ webserver.send(200); }, handleUploadCustomPTYS);
+      webserver.on("/rdslog.bin", HTTP_GET, handleDownloadRDSLog);
+      webserver.on("/rdslog", HTTP_GET, handleRDSLog);
+      webserver.on("/upload_rdslog", HTTP_POST, [](){ webserver.send(200); }, handleUploadRDSLog);
+      webserver.on("/rdsstats", HTTP_GET, handleRDSStats);
+      webserver.on("/scanstats", HTTP_GET, handleScanStats);
+      webserver.on("/dspprofile", HTTP_GET, handleDSPProfile);
+      webserver.on("/bandmap", HTTP_GET, handleBandMap);
       webserver.on("/logo.png", handleLogo);
       webserver.begin();
       NTPupdate();
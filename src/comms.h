@@ -82,6 +82,10 @@ extern int XDRBWsetold;
 extern int16_t OStatus;
 extern int16_t SStatus;
 extern int8_t LowLevelSet;
+extern int8_t seeklevelam;
+extern int8_t seeklevelfm;
+extern int8_t seeksnram;
+extern int8_t seeksnrfm;
 extern int8_t VolSet;
 extern IPAddress remoteip;
 extern String cryptedpassword;
@@ -133,6 +137,7 @@ void passwordcrypt();
 void tryWiFi();
 
 extern void DataPrint(String string);
+extern void DataWrite(const char *data, size_t length);
 extern void ShowFreq(int mode);
 extern void SelectBand();
 extern void doBW();
@@ -27,6 +27,21 @@
 #define TIMER_SNR_TIMER             100
 #define TIMER_BAT_TIMER             (TIMER_500_TICK)
 #define TIMER_500_TICK              500
+#define RDS_SYNC_TIMEOUT            250                                   // ms to wait for RDS sync on a found station
+#define STATUS_MAXAGE               30                                    // ms a quality snapshot may be reused
+#define XDR_SWEEP_BATCH             128                                   // Spectrum points measured per write to XDR-GTK
+#define XDR_SIGNAL_INTERVAL         66                                    // ms between XDR-GTK signal lines, a snapshot this old is still current
+#define AUTOMEM_CANDIDATES          128                                   // Strongest channels kept from the auto memory quality pass
+#define AUTOMEM_RDS_TIMEOUT         1000                                  // ms of RDS collected per candidate at most
+#define AUTOMEM_RDS_POLL            20                                    // ms between RDS reads on a candidate
+#define AUTOMEM_PI_SLOTS            256                                   // PI hash set, over twice EE_PRESETS_CNT
+#define SCAN_DWELL_PROGRESS         1000                                  // ms without RDS progress before a held DX scan channel is left
+#define SCAN_DWELL_EXTEND           2500                                  // ms a DX scan channel may be held past scanhold while RDS comes in
+#define SCAN_DWELL_LOGGED           300                                   // ms a DX scan channel is held once PI and PS are in
+#define SCAN_DWELL_SHORT_HOLD       5                                     // scanhold (s) below which SCAN_DWELL_LOGGED ends the hold early
+#define SEEK_DRAW_INTERVAL          100                                   // ms between frequency redraws while seeking
+#define SEEK_LEVEL_TIME             20                                    // Quality timestamp (0.1 ms) from which a seek step may be passed on its level
+#define PIHUNT_KNOWN                32                                    // Frequencies from presets, band map and logbook tried first
 
 #define BAT_LEVEL_EMPTY             1600
 #define BAT_LEVEL_WARN              1700
@@ -233,12 +248,12 @@
 
 // EEPROM index defines
 #define EE_PRESETS_CNT                99    // When set > 99 change the complete EEPROM adressing!
-#define EE_CHECKBYTE_VALUE            20     // 0 ~ 255,add new entry, change for new value
+#define EE_CHECKBYTE_VALUE            21     // 0 ~ 255,add new entry, change for new value
 #define EE_PRESETS_FREQUENCY          0     // Default value when memory channel should be skipped!
 #ifdef HAS_AIR_BAND
-#define EE_TOTAL_CNT                  2292  // Total occupied eeprom bytes
+#define EE_TOTAL_CNT                  2296  // Total occupied eeprom bytes
 #else
-#define EE_TOTAL_CNT                  2287  // Total occupied eeprom bytes
+#define EE_TOTAL_CNT                  2291  // Total occupied eeprom bytes
 #endif
 
 #define EE_PRESETS_BAND_START         0     // 99 * 1 byte
@@ -362,9 +377,13 @@
 #define EE_BYTE_CLOCKAMPM             2278
 #define EE_UINT16_LOGCOUNTER          2279
 #define EE_UINT16_PICTLOCK            2283
+#define EE_BYTE_SEEKLEVELFM           2287
+#define EE_BYTE_SEEKLEVELAM           2288
+#define EE_BYTE_SEEKSNRFM             2289
+#define EE_BYTE_SEEKSNRAM             2290
 #ifdef HAS_AIR_BAND
-#define EE_BYTE_AIRSTEPSIZE           2287
-#define EE_UINT16_FREQUENCY_AIR       2288
+#define EE_BYTE_AIRSTEPSIZE           2291
+#define EE_UINT16_FREQUENCY_AIR       2292
 #endif
 // End of EEPROM index defines
 
@@ -385,6 +404,14 @@ typedef struct {
   char          RDSPS[9];
 } mem;
 
+// Auto memory candidate, RDS is filled in on the second pass
+typedef struct {
+  unsigned int  frequency;
+  int16_t       score;
+  char          RDSPI[7];
+  char          RDSPS[10];
+} automem;
+
 enum LONGBANDBUTTONPRESS {
   STANDBY = 0, SCREENOFF
 };
@@ -400,6 +427,27 @@ enum SCAN_CANCEL {
   SCAN_CANCEL = OFF, CORRECTPI, SIGNAL
 };
 
+enum SCAN_OUTCOME {
+  SCAN_DEAD = 0, SCAN_SIGNAL, SCAN_RDS, SCAN_PI, SCAN_LOGGED, SCAN_OUTCOMES
+};
+
+// DX scan dwell statistics, per outcome of a channel
+typedef struct {
+  uint32_t      channels[SCAN_OUTCOMES];
+  uint32_t      dwell[SCAN_OUTCOMES];                                     // ms
+  unsigned long start;
+  unsigned long end;                                                      // 0 while the scan runs
+} scanstat;
+
+// Seek stop criterion, every metric has to pass
+typedef struct {
+  int16_t       level;                                                    // Minimum, 0.1 dBuV
+  uint16_t      usn;                                                      // Maximum, AM: noise
+  uint16_t      wam;                                                      // Maximum, AM: co-channel
+  int16_t       offset;                                                   // Maximum deviation either way
+  int8_t        snr;                                                      // Minimum, dB
+} seekstop;
+
 // FM band: before BAND_GAP; AM band: after BAND_GAP
 enum RADIO_BAND {
   BAND_OIRT = 0, BAND_FM, BAND_GAP, BAND_LW, BAND_MW, BAND_SW, BAND_AIR
@@ -615,6 +615,7 @@ void BuildAFScreen() {
   batteryVold = 0;
   vPerold = 0;
   af_counterold = 254;
+  eon_updatecounterold = radio.eon_updatecounter - 1;
   afmethodBold = false;
   PIold = " ";
   PSold = " ";
@@ -3926,10 +3927,12 @@ void MenuUpDown(bool dir) {
             }
 
             if (ConverterSet >= 200) {
+              TunerTask_Lock();
               Wire.beginTransmission(0x12);
               Wire.write(ConverterSet >> 8);
               Wire.write(ConverterSet & (0xFF));
               Wire.endTransmission();
+              TunerTask_Unlock();
             }
 
             OneBigLineSprite.setTextDatum(TL_DATUM);
@@ -62,6 +62,7 @@ extern bool XDRGTKMuteScreen;
 extern bool wifi;
 extern byte af;
 extern byte af_counterold;
+extern byte eon_updatecounterold;
 extern byte afpagenr;
 extern byte amagc;
 extern byte amnb;
@@ -2,6 +2,9 @@
 #include "constants.h"
 #include <EEPROM.h>
 #include "custom_ptys.h"
+#include "BandMap.h"
+
+extern scanstat scanstats;
 
 String UDPlogold = "";
 
@@ -252,10 +255,11 @@ byte addRowToCSV() {
                               String(adjustedFreq % 100) + " MHz";
 
   // Calculate signal strength based on the selected unit
+  int16_t level = radio.getStatusIfOlderThan(STATUS_MAXAGE, band >= BAND_GAP).level;
   int SStatusPrint = 0;
-  if (unit == 0) SStatusPrint = SStatus;  // dBμV
-  else if (unit == 1) SStatusPrint = ((SStatus * 100) + 10875) / 100;  // dBf
-  else if (unit == 2) SStatusPrint = round((float(SStatus) / 10.0 - 10.0 * log10(75) - 90.0) * 10.0);  // dBm
+  if (unit == 0) SStatusPrint = level;  // dBμV
+  else if (unit == 1) SStatusPrint = ((level * 100) + 10875) / 100;  // dBf
+  else if (unit == 2) SStatusPrint = round((float(level) / 10.0 - 10.0 * log10(75) - 90.0) * 10.0);  // dBm
 
   // Format the signal strength with appropriate decimal places and unit
   String signal = String(SStatusPrint / 10) + "." + String(abs(SStatusPrint % 10));
@@ -264,13 +268,13 @@ byte addRowToCSV() {
   else if (unit == 2) signal += " dBm";
 
   // Prepare the radio text with station information, including enhanced options if available
-  String radioText = String(radio.rds.stationText + " " + radio.rds.stationText32);
+  String radioText = String(radio.rds.stationText) + " " + radio.rds.stationText32.c_str();
   if (radio.rds.hasEnhancedRT) {
     radioText += " eRT: " + String(radio.rds.enhancedRTtext);
   }
 
   // Replace commas in the station name and radio text to avoid CSV conflicts
-  String stationName = radio.rds.stationName;
+  String stationName = radio.rds.stationName.c_str();
   String radioTextModified = (scanhold > 4 ? radioText : "");
   stationName.replace(",", " ");  // Replace commas in station name
   radioTextModified.replace(",", " ");  // Replace commas in radio text
@@ -313,6 +317,42 @@ byte addRowToCSV() {
   }
 }
 
+// FM frequencies of the logbook rows carrying pi, in 10 kHz units without
+// the converter offset. Returns how many were put in frequencies.
+uint8_t findLogbookPI(uint16_t pi, uint16_t *frequencies, uint8_t max) {
+  fs::File file = SPIFFS.open("/logbook.csv", "r");
+  if (!file) return 0;
+
+  char line[64];
+  uint8_t count = 0;
+  while (file.available() && count < max) {
+    size_t length = file.readBytesUntil('\n', line, sizeof(line) - 1);
+    line[length] = '\0';
+    if (length == sizeof(line) - 1) {                                     // Long RadioText, skip the rest of the row
+      while (file.available() && file.read() != '\n');
+    }
+
+    char *field = strchr(line, ',');                                      // Date,Time,Frequency,PI
+    if (field) field = strchr(field + 1, ',');
+    if (!field) continue;
+    char *end;
+    unsigned long mhz = strtoul(field + 1, &end, 10);
+    if (*end != '.') continue;
+    unsigned long khz = strtoul(end + 1, &end, 10);
+    if (*end != ' ' || !(end = strchr(end, ','))) continue;
+    if (strtoul(end + 1, NULL, 16) != pi || strlen(end + 1) < 4) continue;
+
+    long freq = (long)(mhz * 100 + khz) - ConverterSet * 100;
+    if (freq < 8750 || freq > 10800) continue;
+
+    bool listed = false;
+    for (uint8_t i = 0; i < count && !listed; i++) listed = frequencies[i] == freq;
+    if (!listed) frequencies[count++] = freq;
+  }
+  file.close();
+  return count;
+}
+
 String getCurrentDateTime(bool inUTC) {
   // Check if the RTC has been set
   if (!rtcset) {
@@ -475,10 +515,11 @@ void sendUDPlog() {
                               String(adjustedFreq % 100);
 
   // Calculate signal strength and format it with the selected unit
+  int16_t level = radio.getStatusIfOlderThan(STATUS_MAXAGE, band >= BAND_GAP).level;
   int SStatusPrint = 0;
-  if (unit == 0) SStatusPrint = SStatus;  // dBμV
-  else if (unit == 1) SStatusPrint = ((SStatus * 100) + 10875) / 100;  // dBf
-  else if (unit == 2) SStatusPrint = round((float(SStatus) / 10.0 - 10.0 * log10(75) - 90.0) * 10.0);  // dBm
+  if (unit == 0) SStatusPrint = level;  // dBμV
+  else if (unit == 1) SStatusPrint = ((level * 100) + 10875) / 100;  // dBf
+  else if (unit == 2) SStatusPrint = round((float(level) / 10.0 - 10.0 * log10(75) - 90.0) * 10.0);  // dBm
 
   String signal = String(SStatusPrint / 10) + "." + String(abs(SStatusPrint % 10));
   if (unit == 0) signal += " dBμV";
@@ -486,13 +527,13 @@ void sendUDPlog() {
   else if (unit == 2) signal += " dBm";
 
   // Prepare the radio text with RDS station information and enhanced options
-  String radioText = String(radio.rds.stationText + " " + radio.rds.stationText32);
+  String radioText = String(radio.rds.stationText) + " " + radio.rds.stationText32.c_str();
   if (radio.rds.hasEnhancedRT) {
     radioText += " eRT: " + String(radio.rds.enhancedRTtext);
   }
 
   // Replace commas in the station name and radio text to avoid conflicts in the CSV format
-  String stationName = radio.rds.stationName;
+  String stationName = radio.rds.stationName.c_str();
   stationName.replace(",", " ");
   String radioTextModified = radioText;
   radioTextModified.replace(",", " ");
@@ -517,7 +558,7 @@ void sendUDPlog() {
   String AF = "";
   if (radio.rds.hasAF && radio.af_counter > 0) {
     for (byte i = 0; i < radio.af_counter; i++) {
-      AF += String(radio.af[i].frequency / 100) + "." + String((radio.af[i].frequency % 100) / 10) +
+      AF += String(radio.af.frequency[i] / 100) + "." + String((radio.af.frequency[i] % 100) / 10) +
             (i == radio.af_counter - 1 ? "" : ";");
     }
   }
@@ -526,11 +567,12 @@ void sendUDPlog() {
   String EON = "";
   if (radio.eon_counter > 0) {
     for (byte i = 0; i < radio.eon_counter; i++) {
-      EON += String(radio.eon[i].picode) +
-             (radio.eon[i].ps.length() > 0 ? String(";" + radio.eon[i].ps) : ";") +
-             (radio.eon[i].mappedfreq > 0 ? String(";" + String(radio.eon[i].mappedfreq / 100) + "." + String((radio.eon[i].mappedfreq % 100) / 10)) : ";") +
-             (radio.eon[i].mappedfreq2 > 0 ? String(";" + String(radio.eon[i].mappedfreq2 / 100) + "." + String((radio.eon[i].mappedfreq2 % 100) / 10)) : ";") +
-             (radio.eon[i].mappedfreq3 > 0 ? String(";" + String(radio.eon[i].mappedfreq3 / 100) + "." + String((radio.eon[i].mappedfreq3 % 100) / 10)) : ";") +
+      byte e = radio.eon.order[i];
+      EON += String(radio.eon.picode[e]) +
+             (radio.eon.ps[e].length() > 0 ? String(";" + String(radio.eon.ps[e])) : ";") +
+             (radio.eon.mappedfreq[e] > 0 ? String(";" + String(radio.eon.mappedfreq[e] / 100) + "." + String((radio.eon.mappedfreq[e] % 100) / 10)) : ";") +
+             (radio.eon.mappedfreq2[e] > 0 ? String(";" + String(radio.eon.mappedfreq2[e] / 100) + "." + String((radio.eon.mappedfreq2[e] % 100) / 10)) : ";") +
+             (radio.eon.mappedfreq3[e] > 0 ? String(";" + String(radio.eon.mappedfreq3[e] / 100) + "." + String((radio.eon.mappedfreq3[e] % 100) / 10)) : ";") +
              (i == radio.eon_counter - 1 ? "" : ";");
     }
   }
@@ -547,7 +589,7 @@ void sendUDPlog() {
   // Extract RT+ (RadioText Plus) content if available
   String RTPLUS = "";
   if (radio.rds.hasRDSplus) {
-    RTPLUS += radio.rds.RTContent1 + ";" + radio.rds.RTContent2;
+    RTPLUS += String(radio.rds.RTContent1) + ";" + radio.rds.RTContent2.c_str();
   }
 
   // Construct the data row to send via UDP
@@ -642,4 +684,134 @@ void handleUploadCustomPTYS() {
     html += "</body></html>";
     webserver.send(200, "text/html", html);
   }
-}
\ No newline at end of file
+}
+void handleDownloadRDSLog() {
+  RdsLog_Stop();                                                          // Downloading ends a running capture
+  if (!SPIFFS.exists(RDS_LOG_FILE)) {
+    webserver.send(404, "text/plain", "No RDS capture");
+    return;
+  }
+  fs::File file = SPIFFS.open(RDS_LOG_FILE, "r");
+  if (!file) {
+    webserver.send(500, "text/plain", "Failed to open RDS capture");
+    return;
+  }
+  webserver.sendHeader("Content-Disposition", "attachment; filename=rdslog.bin");
+  webserver.streamFile(file, "application/octet-stream");
+  file.close();
+}
+
+// /rdslog?cmd=start|stop|replay[&speed=percent]
+void handleRDSLog() {
+  String cmd = webserver.arg("cmd");
+  bool ok = true;
+
+  if (cmd == "start") {
+    ok = RdsLog_Start();
+  } else if (cmd == "stop") {
+    RdsLog_Stop();
+    RdsLog_StopReplay();
+  } else if (cmd == "replay") {
+    ok = RdsLog_Replay(webserver.hasArg("speed") ? webserver.arg("speed").toInt() : 100);
+  }
+
+  String status = RdsLog_Recording() ? "recording" : (RdsLog_Replaying() ? "replaying" : "idle");
+  status += ", " + String(RdsLog_Records()) + " groups\n";
+  webserver.send(ok ? 200 : 500, "text/plain", status);
+}
+
+void handleUploadRDSLog() {
+  HTTPUpload& upload = webserver.upload();
+  static fs::File file;
+  if (upload.status == UPLOAD_FILE_START) {
+    RdsLog_Stop();
+    RdsLog_StopReplay();
+    file = SPIFFS.open(RDS_LOG_FILE, "w");
+    if (!file) {
+      webserver.send(500, "text/plain", "Failed to open file for writing");
+      return;
+    }
+  } else if (upload.status == UPLOAD_FILE_WRITE) {
+    if (file) file.write(upload.buf, upload.currentSize);
+  } else if (upload.status == UPLOAD_FILE_END) {
+    if (file) {
+      file.flush(); file.close();
+    }
+    webserver.send(200, "text/plain", "RDS capture saved, replay with /rdslog?cmd=replay\n");
+  }
+}
+
+// Decoder profile: groups and CPU time per RDS group handler
+void handleRDSStats() {
+  String stats = "handler  on  groups  us_total  us_avg\n";
+  char line[64];
+
+  for (uint8_t i = 0; i < RDS_HANDLER_COUNT; i++) {
+    const rdshandler_ &handler = radio.rdshandler[i];
+    snprintf(line, sizeof(line), "%-8s %-3s %7lu %9lu %7lu\n", radio.RDSHandlerName(i), handler.enabled ? "yes" : "no", (unsigned long)handler.calls, (unsigned long)handler.micros, (unsigned long)(handler.calls ? handler.micros / handler.calls : 0));
+    stats += line;
+  }
+  snprintf(line, sizeof(line), "groups %lu, overflow %lu, dropped %lu\n", (unsigned long)tunerrdsstats.received, (unsigned long)tunerrdsstats.overflow, (unsigned long)tunerrdsstats.dropped);
+  stats += line;
+  snprintf(line, sizeof(line), "writes queued %lu, failed %lu, bus failed %lu\n", (unsigned long)tunertaskstats.queued, (unsigned long)TunerTask_Failed(), (unsigned long)tunerbusstats.failed);
+  stats += line;
+  if (webserver.hasArg("reset")) {
+    radio.resetRDSHandlerStats();
+    TunerRDS_ResetStats();
+  }
+  webserver.send(200, "text/plain", stats);
+}
+
+// /scanstats, channels and dwell time of the last or running DX scan per outcome
+void handleScanStats() {
+  static const char* const outcomes[SCAN_OUTCOMES] = {"dead", "signal", "rds", "pi", "logged"};
+  String stats = "outcome  channels  ms_total  ms_avg\n";
+  char line[64];
+  uint32_t channels = 0;
+
+  for (uint8_t i = 0; i < SCAN_OUTCOMES; i++) {
+    snprintf(line, sizeof(line), "%-8s %8lu %9lu %7lu\n", outcomes[i], (unsigned long)scanstats.channels[i], (unsigned long)scanstats.dwell[i], (unsigned long)(scanstats.channels[i] ? scanstats.dwell[i] / scanstats.channels[i] : 0));
+    stats += line;
+    channels += scanstats.channels[i];
+  }
+  unsigned long duration = scanstats.start ? (scanstats.end ? scanstats.end : millis()) - scanstats.start : 0;
+  snprintf(line, sizeof(line), "%s, %lu channels in %lu ms, %lu/min\n", scanstats.start && !scanstats.end ? "running" : "idle", (unsigned long)channels, duration, duration ? channels * 60000UL / duration : 0);
+  stats += line;
+  webserver.send(200, "text/plain", stats);
+}
+
+// /dspprofile[?name=], applies a named DSP profile and lists them all. Like
+// the XDR-GTK setters it only changes the tuner, the menu settings come
+// back with the next band or bandwidth change.
+void handleDSPProfile() {
+  String reply;
+  bool ok = true;
+
+  if (webserver.hasArg("name")) {
+    uint8_t sent = 0;
+    ok = radio.applyProfile(webserver.arg("name").c_str(), &sent);
+    reply = webserver.arg("name") + (ok ? ": applied, " + String(sent) + " settings sent\n" : ": unknown profile\n");
+  }
+  for (uint8_t i = 0; radio.profileName(i) != nullptr; i++) reply += String(radio.profileName(i)) + "\n";
+  webserver.send(ok ? 200 : 404, "text/plain", reply);
+}
+
+// /bandmap[?am][&clear], the channels ever found occupied, best first
+void handleBandMap() {
+  static int16_t slots[BANDMAP_SLOTS];
+  bool am = webserver.hasArg("am");
+  String map = "freq    level  best  usn  wam  PI    PS        lastseen\n";
+  char line[80];
+
+  if (webserver.hasArg("clear")) BandMap_Clear();
+  uint16_t count = BandMap_Rank(slots, BANDMAP_SLOTS, am);
+  for (uint16_t i = 0; i < count; i++) {
+    const bandmapentry_ *entry = BandMap_Entry(slots[i]);
+    uint16_t freq = BandMap_Frequency(slots[i]);
+    if (am) snprintf(line, sizeof(line), "%-7u", freq); else snprintf(line, sizeof(line), "%3u.%02u ", freq / 100, freq % 100);
+    map += line;
+    snprintf(line, sizeof(line), "%6d %5d %4u %4u %04X  %-8.8s  %lu\n", entry->level, entry->bestlevel, entry->usn, entry->wam, entry->pi, entry->ps, (unsigned long)entry->lastseen);
+    map += line;
+  }
+  webserver.send(200, "text/plain", map);
+}
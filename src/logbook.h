@@ -37,8 +37,16 @@ void handleRoot();
 void handleDownloadCSV();
 void handleUploadCustomPTYSForm();
 void handleUploadCustomPTYS();
+void handleDownloadRDSLog();
+void handleRDSLog();
+void handleUploadRDSLog();
+void handleRDSStats();
+void handleScanStats();
+void handleDSPProfile();
+void handleBandMap();
 bool handleCreateNewLogbook();
 byte addRowToCSV();
+uint8_t findLogbookPI(uint16_t pi, uint16_t *frequencies, uint8_t max);
 String getCurrentDateTime(bool inUTC);
 bool isDST(time_t t);
 void handleLogo();
@@ -19,6 +19,11 @@ float smoothBER = 0;
 int RadiotextWidth, PSLongWidth, AIDWidth, afstringWidth, eonstringWidth, rtplusstringWidth, lengths[7];
 String afstringold, eonstringold, rtplusstringold, stationNameLongOld, AIDStringold;
 bool rtABold, ps12errorold, ps34errorold, ps56errorold, ps78errorold;
+String stationNameToShow, RTString;                                       // Rebuilt when the RDS text sequence changes
+uint16_t PSseqold, RTseqold[3] = {0xffff, 0xffff, 0xffff};
+uint32_t PSfreqold;
+unsigned int RTfreqold;
+bool RTeRTold;
 
 void ShowAdvancedRDS() {
   if (!dropout) {
@@ -62,7 +67,7 @@ void ShowAdvancedRDS() {
 
   if (licold != radio.rds.LIC || rdsreset) {
     if (!screenmute) {
-      if (radio.rds.hasLIC) LICString = (radio.rds.LICtext.length() == 0 ? textUI(73) : radio.rds.LICtext); else LICString = "N/A";
+      if (radio.rds.hasLIC) LICString = (*radio.rds.LICtext == '\0' ? textUI(73) : radio.rds.LICtext); else LICString = "N/A";
       if (LICString != LIColdString) {
         tftPrint(ALEFT, "N/A", 242, 208, BackgroundColor, BackgroundColor, 16);
         tftPrint(ALEFT, LIColdString, 242, 208, BackgroundColor, BackgroundColor, 16);
@@ -85,7 +90,7 @@ void ShowAdvancedRDS() {
   }
 
   String afstring;
-  if (radio.rds.hasAF && radio.af_counter > 0) for (byte i = 0; i < radio.af_counter; i++) afstring += String(radio.af[i].frequency / 100) + "." + String((radio.af[i].frequency % 100) / 10) + (i == radio.af_counter - 1 ? "        " : " | "); else afstring = textUI(87);
+  if (radio.rds.hasAF && radio.af_counter > 0) for (byte i = 0; i < radio.af_counter; i++) afstring += String(radio.af.frequency[i] / 100) + "." + String((radio.af.frequency[i] % 100) / 10) + (i == radio.af_counter - 1 ? "        " : " | "); else afstring = textUI(87);
   if (hasafold != radio.rds.hasAF) {
     if (!screenmute) {
       if (radio.rds.hasAF) tftPrint(ALEFT, "AF", 50, 51, RDSColor, RDSColorSmooth, 16); else tftPrint(ALEFT, "AF", 50, 51, GreyoutColor, BackgroundColor, 16);
@@ -126,7 +131,14 @@ void ShowAdvancedRDS() {
   }
 
   String eonstring;
-  if (radio.eon_counter > 0) for (byte i = 0; i < radio.eon_counter; i++) eonstring += String(radio.eon[i].picode) + (radio.eon[i].ps.length() > 0 ? String(": " + String(radio.eon[i].ps)) : "") + (radio.eon[i].mappedfreq > 0 ? String(" " + String(radio.eon[i].mappedfreq / 100) + "." + String((radio.eon[i].mappedfreq % 100) / 10))  : "") + (radio.eon[i].mappedfreq2 > 0 ? String(" / " + String(radio.eon[i].mappedfreq2 / 100) + "." + String((radio.eon[i].mappedfreq2 % 100) / 10))  : "") + (radio.eon[i].mappedfreq3 > 0 ? String(" /  " + String(radio.eon[i].mappedfreq3 / 100) + "." + String((radio.eon[i].mappedfreq3 % 100) / 10))  : "") + (i == radio.eon_counter - 1 ? "        " : " | "); else eonstring = textUI(88);
+  if (radio.eon_counter > 0) {
+    for (byte i = 0; i < radio.eon_counter; i++) {
+      byte e = radio.eon.order[i];
+      eonstring += String(radio.eon.picode[e]) + (radio.eon.ps[e].length() > 0 ? String(": " + String(radio.eon.ps[e])) : "") + (radio.eon.mappedfreq[e] > 0 ? String(" " + String(radio.eon.mappedfreq[e] / 100) + "." + String((radio.eon.mappedfreq[e] % 100) / 10))  : "") + (radio.eon.mappedfreq2[e] > 0 ? String(" / " + String(radio.eon.mappedfreq2[e] / 100) + "." + String((radio.eon.mappedfreq2[e] % 100) / 10))  : "") + (radio.eon.mappedfreq3[e] > 0 ? String(" /  " + String(radio.eon.mappedfreq3[e] / 100) + "." + String((radio.eon.mappedfreq3[e] % 100) / 10))  : "") + (i == radio.eon_counter - 1 ? "        " : " | ");
+    }
+  } else {
+    eonstring = textUI(88);
+  }
   if (haseonold != radio.rds.hasEON) {
     if (!screenmute)  {
       if (radio.eon_counter > 0) tftPrint(ALEFT, "EON", 153, 51, RDSColor, RDSColorSmooth, 16); else tftPrint(ALEFT, "EON", 153, 51, GreyoutColor, BackgroundColor, 16);
@@ -274,10 +286,10 @@ void doAF() {
 
       for (byte af_scan = 0; af_scan < radio.af_counter; af_scan++) {
         if (wifi) {
-          if ((radio.af[af_scan].frequency - 8750) / 10 < 0x10) {
+          if ((radio.af.frequency[af_scan] - 8750) / 10 < 0x10) {
             Udp.print("0");
           }
-          Udp.print(String((radio.af[af_scan].frequency - 8750) / 10, HEX));
+          Udp.print(String((radio.af.frequency[af_scan] - 8750) / 10, HEX));
         }
       }
 
@@ -292,7 +304,7 @@ void showECC() {
   if (ECCold != radio.rds.ECC) {
     if (advancedRDS) {
       if (!screenmute) {
-        if (radio.rds.hasECC) ECCString = (radio.rds.ECCtext.length() == 0 ? textUI(73) : radio.rds.ECCtext); else ECCString = "N/A";
+        if (radio.rds.hasECC) ECCString = (*radio.rds.ECCtext == '\0' ? textUI(73) : radio.rds.ECCtext); else ECCString = "N/A";
         if (ECCString != ECColdString) {
           tftPrint(ALEFT, "N/A", 242, 193, BackgroundColor, BackgroundColor, 16);
           tftPrint(ALEFT, ECColdString, 242, 193, BackgroundColor, BackgroundColor, 16);
@@ -317,7 +329,8 @@ void readRds() {
   // Only process RDS on FM bands
   if (band >= BAND_GAP) return;
 
-  // Read RDS data from tuner
+  // Read RDS data from tuner, only the basics when nobody looks at the rest
+  radio.setRDSHandlers((screenmute || scandxmode) ? RDS_HANDLERS_LEAN : RDS_HANDLERS_ALL);
   radio.readRDS(showrdserrors);
   RDSstatus = radio.rds.hasRDS;
   ShowRDSLogo(RDSstatus);
@@ -394,7 +407,7 @@ void readRds() {
                              (i < 6 && ps56errorold) || ps78errorold;
                 PSSprite.setTextColor(error ? RDSDropoutColor : RDSColor,
                                       RDSColorSmooth, false);
-                PSSprite.drawString(radio.rds.stationName.substring(i, i + 1),
+                PSSprite.drawString(String(radio.rds.stationName.c_str()).substring(i, i + 1),
                                     i == 0 ? 0 : lengths[i - 1], 2);
               }
             } else {
@@ -474,16 +487,13 @@ void readRds() {
       XDRGTKRDS += '\n';
 
       if (XDRGTKRDS != XDRGTKRDSold) {
-        uint8_t piError = radio.rds.rdsErr >> 14;
-        if (piError < 3) {
-          uint8_t piState = radio.rds.piBuffer.add(radio.rds.rdsA, piError);
-          if (piState != RdsPiBuffer::STATE_INVALID) {
-            DataPrint(F("P"));
-            sprintf(hexbuf, "%04X", radio.rds.rdsA);
-            DataPrint(hexbuf);
-            while (piState--) DataPrint(F("?"));
-            DataPrint(F("\n"));
-          }
+        uint8_t piState = radio.rds.piState;                              // Kept up to date by the decoder
+        if (piState != RdsPiBuffer<>::STATE_INVALID) {
+          DataPrint(F("P"));
+          sprintf(hexbuf, "%04X", radio.rds.rdsA);
+          DataPrint(hexbuf);
+          while (piState--) DataPrint(F("?"));
+          DataPrint(F("\n"));
         }
         XDRGTKRDSold = XDRGTKRDS;
         XDRGTKRDS.toUpperCase();
@@ -568,7 +578,7 @@ void ShowErrors() {
 }
 
 void showPI() {
-  if ((radio.rds.region != 0 && (String(radio.rds.picode) != PIold || radio.rds.stationIDtext != stationIDold || radio.rds.stationStatetext != stationStateold)) || (radio.rds.region == 0 && String(radio.rds.picode) != PIold)) {
+  if ((radio.rds.region != 0 && (String(radio.rds.picode) != PIold || stationIDold != radio.rds.stationIDtext || stationStateold != radio.rds.stationStatetext)) || (radio.rds.region == 0 && String(radio.rds.picode) != PIold)) {
     if (!rdsstatscreen && !afscreen && !radio.rds.rdsAerror && !radio.rds.rdsBerror && !radio.rds.rdsCerror && !radio.rds.rdsDerror && radio.rds.rdsA != radio.rds.correctPI && PIold.length() > 1) {
       radio.clearRDS(fullsearchrds);
       if (RDSSPYUSB) Serial.print("G:\r\nRESET-------\r\n\r\n");
@@ -586,12 +596,12 @@ void showPI() {
         } else {
           if (!RDSstatus) {
             if (String(radio.rds.picode) != PIold) tftReplace(ALEFT, PIold, radio.rds.picode, 240, 72, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
-            tftReplace(ALEFT, stationIDold, radio.rds.stationIDtext, 240, 89, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
+            tftReplace(ALEFT, stationIDold, String(radio.rds.stationIDtext), 240, 89, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
           } else {
             if (String(radio.rds.picode) != PIold) tftReplace(ALEFT, PIold, radio.rds.picode, 240, 72, RDSColor, RDSColorSmooth, BackgroundColor, 16);
-            tftReplace(ALEFT, stationIDold, radio.rds.stationIDtext, 240, 89, RDSColor, RDSColorSmooth, BackgroundColor, 16);
+            tftReplace(ALEFT, stationIDold, String(radio.rds.stationIDtext), 240, 89, RDSColor, RDSColorSmooth, BackgroundColor, 16);
           }
-          tftReplace(ARIGHT, stationStateold, radio.rds.stationStatetext, 318, 89, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
+          tftReplace(ARIGHT, stationStateold, String(radio.rds.stationStatetext), 318, 89, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
         }
       } else if (afscreen) {
         tftReplace(ALEFT, PIold, radio.rds.picode, 30, 201, BWAutoColor, BWAutoColorSmooth, BackgroundColor, 16);
@@ -604,15 +614,15 @@ void showPI() {
           }
         } else {
           if (!RDSstatus) {
-            if (String(radio.rds.picode) != PIold || radio.rds.stationIDtext != stationIDold) {
+            if (String(radio.rds.picode) != PIold || stationIDold != radio.rds.stationIDtext) {
               tftReplace(ALEFT, PIold, radio.rds.picode, 240, 184, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
-              tftReplace(ALEFT, stationIDold, radio.rds.stationIDtext, 240, 201, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
+              tftReplace(ALEFT, stationIDold, String(radio.rds.stationIDtext), 240, 201, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
             }
           } else {
-            if (String(radio.rds.picode) != PIold || radio.rds.stationIDtext != stationIDold) {
+            if (String(radio.rds.picode) != PIold || stationIDold != radio.rds.stationIDtext) {
               tftReplace(ALEFT, PIold, radio.rds.picode, 240, 184, RDSColor, RDSColorSmooth, BackgroundColor, 16);
-              tftReplace(ALEFT, stationIDold, radio.rds.stationIDtext, 240, 201, RDSColor, RDSColorSmooth, BackgroundColor, 16);
-              tftReplace(ARIGHT, stationStateold, radio.rds.stationStatetext, 318, 201, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
+              tftReplace(ALEFT, stationIDold, String(radio.rds.stationIDtext), 240, 201, RDSColor, RDSColorSmooth, BackgroundColor, 16);
+              tftReplace(ARIGHT, stationStateold, String(radio.rds.stationStatetext), 318, 201, RDSDropoutColor, RDSDropoutColorSmooth, BackgroundColor, 16);
             }
           }
         }
@@ -697,13 +707,17 @@ void showPS() {
   } else if (band == BAND_OIRT) {
     currentFreqKhz = frequency_OIRT * 10;
   }
-  String customPS = "";
-  if (currentFreqKhz > 0) {
-    customPS = findCustomPSForFreq(currentFreqKhz);
+  // Only rebuild the PS to show when the decoder changed it or we retuned
+  if (radio.rds.stationName.sequence() != PSseqold || currentFreqKhz != PSfreqold) {
+    String customPS = "";
+    if (currentFreqKhz > 0) {
+      customPS = findCustomPSForFreq(currentFreqKhz);
+    }
+    stationNameToShow = customPS.length() > 0 ? customPS : String(radio.rds.stationName.c_str());
+    PSseqold = radio.rds.stationName.sequence();
+    PSfreqold = currentFreqKhz;
   }
 
-  String stationNameToShow = customPS.length() > 0 ? customPS : radio.rds.stationName;
-
   if ((stationNameToShow != PSold) ||
       (RDSstatus && !(ps12errorold == radio.rds.ps12error ||
                       ps34errorold == radio.rds.ps34error ||
@@ -943,20 +957,26 @@ void showCT() {
 }
 
 void showRadioText() {
-  // Build the radio text string
-  String radioRT = radio.rds.stationText +
-                   (radio.rds.stationText.length() > 0 ? " " : "") +
-                   radio.rds.stationText32 +
-                   (radio.rds.hasEnhancedRT ? " eRT: " + String(radio.rds.enhancedRTtext) : "");
-  String customRT = findCustomRTForFreq((uint32_t)frequency * 10);
-  String radioRTtrimmed = radioRT; radioRTtrimmed.trim();
-  String RTString;
-  if (customRT.length() > 0 && radioRTtrimmed.length() > 0)
-    RTString = customRT + " - " + radioRT + "      ";
-  else if (customRT.length() > 0)
-    RTString = customRT + "      ";
-  else
-    RTString = radioRT + "      ";
+  // Build the radio text string, only when one of its parts has changed
+  if (radio.rds.stationText.sequence() != RTseqold[0] || radio.rds.stationText32.sequence() != RTseqold[1] || radio.rds.enhancedRTtext.sequence() != RTseqold[2] || radio.rds.hasEnhancedRT != RTeRTold || frequency != RTfreqold) {
+    String radioRT = String(radio.rds.stationText) +
+                     (radio.rds.stationText.length() > 0 ? " " : "") +
+                     radio.rds.stationText32.c_str() +
+                     (radio.rds.hasEnhancedRT ? " eRT: " + String(radio.rds.enhancedRTtext) : "");
+    String customRT = findCustomRTForFreq((uint32_t)frequency * 10);
+    String radioRTtrimmed = radioRT; radioRTtrimmed.trim();
+    if (customRT.length() > 0 && radioRTtrimmed.length() > 0)
+      RTString = customRT + " - " + radioRT + "      ";
+    else if (customRT.length() > 0)
+      RTString = customRT + "      ";
+    else
+      RTString = radioRT + "      ";
+    RTseqold[0] = radio.rds.stationText.sequence();
+    RTseqold[1] = radio.rds.stationText32.sequence();
+    RTseqold[2] = radio.rds.enhancedRTtext.sequence();
+    RTeRTold = radio.rds.hasEnhancedRT;
+    RTfreqold = frequency;
+  }
 
   // Check if RT has changed
   if (radio.rds.hasRT && radio.rds.rtAB != rtABold) {
@@ -1065,7 +1085,7 @@ void showRadioText() {
       Udp.print("from=TEF_tuner_" + String(stationlistid, DEC) + ";RT1=");
 
       char RThex[65];
-      radio.rds.stationText.toCharArray(RThex, 65);
+      strlcpy(RThex, radio.rds.stationText.c_str(), sizeof(RThex));
       for (int i = 0; i < 64; i++) {
         if (RThex[i] < 0x10) Udp.print("0");
         if (RThex[i] == ' ') RThex[i] = '_';
@@ -1099,13 +1119,13 @@ void ShowAFEON() {
       if (af_counterold != radio.af_updatecounter) {
         tft.fillRect(2, 48, 316, 150, BackgroundColor);
         for (byte i = 0; i < radio.af_counter; i++) {
-          tftPrint(ALEFT, (radio.afmethodB && !radio.af[i].regional && radio.af[i].same) ? "S " : (radio.afmethodB && radio.af[i].regional && radio.af[i].same) ? "M " : (radio.afmethodB && radio.af[i].regional && !radio.af[i].same) ? "R " : "", 10 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), ActiveColor, ActiveColorSmooth, 16);
-          if (radio.af[i].checked) {
-            tftPrint(ARIGHT, String(radio.af[i].frequency / 100) + "." + String((radio.af[i].frequency % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), InsignificantColor, InsignificantColorSmooth, 16);
-          } else if (!radio.af[i].afvalid) {
-            tftPrint(ARIGHT, String(radio.af[i].frequency / 100) + "." + String((radio.af[i].frequency % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), SignificantColor, SignificantColorSmooth, 16);
+          tftPrint(ALEFT, (radio.afmethodB && !radio.af.flag[i].regional && radio.af.flag[i].same) ? "S " : (radio.afmethodB && radio.af.flag[i].regional && radio.af.flag[i].same) ? "M " : (radio.afmethodB && radio.af.flag[i].regional && !radio.af.flag[i].same) ? "R " : "", 10 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), ActiveColor, ActiveColorSmooth, 16);
+          if (radio.af.flag[i].checked) {
+            tftPrint(ARIGHT, String(radio.af.frequency[i] / 100) + "." + String((radio.af.frequency[i] % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), InsignificantColor, InsignificantColorSmooth, 16);
+          } else if (!radio.af.flag[i].afvalid) {
+            tftPrint(ARIGHT, String(radio.af.frequency[i] / 100) + "." + String((radio.af.frequency[i] % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), SignificantColor, SignificantColorSmooth, 16);
           } else {
-            tftPrint(ARIGHT, String(radio.af[i].frequency / 100) + "." + String((radio.af[i].frequency % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), RDSColor, RDSColorSmooth, 16);
+            tftPrint(ARIGHT, String(radio.af.frequency[i] / 100) + "." + String((radio.af.frequency[i] % 100) / 10), 55 + (i > 9 ? 54 : 0) + (i > 19 ? 54 : 0) + (i > 29 ? 54 : 0) + (i > 39 ? 54 : 0), 48 + (15 * i) - (i > 9 ? 150 : 0) - (i > 19 ? 150 : 0) - (i > 29 ? 150 : 0) - (i > 39 ? 150 : 0), RDSColor, RDSColorSmooth, 16);
           }
         }
         if (radio.af_counter > 10) tft.drawLine(59, 54, 59, 191, SecondaryColor);
@@ -1126,8 +1146,8 @@ void ShowAFEON() {
         haseonold = true;
       }
 
-      if (millis() >= eonticker + 2000) {
-        eonticker = millis();
+      if (eon_updatecounterold != radio.eon_updatecounter) {
+        eon_updatecounterold = radio.eon_updatecounter;
         byte y = 0;
         if (afpagenr == 3) y = 10;
 
@@ -1140,6 +1160,7 @@ void ShowAFEON() {
 
 
         for (byte i = 0; i < eon_numbers; i++) {
+          byte e = radio.eon.order[i + y];
           if (eonpicodeold[i + y] == nullptr) {
             strcpy(eonpicodeold[i + y], "");
           }
@@ -1159,88 +1180,88 @@ void ShowAFEON() {
             eonptyold[i + y] = 0;
           }
 
-          if (strcmp(eonpicodeold[i + y], radio.eon[i + y].picode) != 0) {
+          if (strcmp(eonpicodeold[i + y], radio.eon.picode[e]) != 0) {
             tftPrint(ALEFT, eonpicodeold[i + y], 4, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
           }
-          tftPrint(ALEFT, radio.eon[i + y].picode, 4, 48 + (15 * i), RDSColor, RDSColorSmooth, 16);
-          strcpy(eonpicodeold[i + y], radio.eon[i + y].picode);
+          tftPrint(ALEFT, radio.eon.picode[e], 4, 48 + (15 * i), RDSColor, RDSColorSmooth, 16);
+          strcpy(eonpicodeold[i + y], radio.eon.picode[e]);
 
-          if (radio.eon[i + y].ps.length() > 0) {
+          if (radio.eon.ps[e].length() > 0) {
             tftPrint(ALEFT, "PS", 46, 32, ActiveColor, ActiveColorSmooth, 16);
 
-            if (strcmp(radio.eon[i + y].ps.c_str(), eonpsold[i + y].c_str()) != 0) {
+            if (strcmp(radio.eon.ps[e].c_str(), eonpsold[i + y].c_str()) != 0) {
               tftPrint(ALEFT, eonpsold[i + y].c_str(), 46, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
             }
-            tftPrint(ALEFT, radio.eon[i + y].ps.c_str(), 46, 48 + (15 * i), RDSDropoutColor, RDSDropoutColorSmooth, 16);
-            eonpsold[i + y] = radio.eon[i + y].ps;
+            tftPrint(ALEFT, radio.eon.ps[e].c_str(), 46, 48 + (15 * i), RDSDropoutColor, RDSDropoutColorSmooth, 16);
+            eonpsold[i + y] = radio.eon.ps[e];
           } else {
             tftPrint(ALEFT, eonpsold[i + y].c_str(), 46, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
           }
 
-          if (radio.eon[i + y].mappedfreq > 0) {
+          if (radio.eon.mappedfreq[e] > 0) {
             tftPrint(ALEFT, "MF", 119, 32, ActiveColor, ActiveColorSmooth, 16);
 
-            if (radio.eon[i + y].mappedfreq != mappedfreqold[i + y]) {
+            if (radio.eon.mappedfreq[e] != mappedfreqold[i + y]) {
               char oldFreq[10];
               dtostrf(mappedfreqold[i + y] / 100.0, 5, 1, oldFreq);
               tftPrint(ALEFT, oldFreq, 115, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
             }
             char newFreq[10];
-            dtostrf(radio.eon[i + y].mappedfreq / 100.0, 5, 1, newFreq);
+            dtostrf(radio.eon.mappedfreq[e] / 100.0, 5, 1, newFreq);
             tftPrint(ALEFT, newFreq, 115, 48 + (15 * i), RDSDropoutColor, RDSDropoutColorSmooth, 16);
-            mappedfreqold[i + y] = radio.eon[i + y].mappedfreq;
+            mappedfreqold[i + y] = radio.eon.mappedfreq[e];
           } else {
             char oldFreq[10];
             dtostrf(mappedfreqold[i + y] / 100.0, 5, 1, oldFreq);
             tftPrint(ALEFT, oldFreq, 115, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
           }
 
-          if (radio.eon[i + y].mappedfreq2 > 0) {
+          if (radio.eon.mappedfreq2[e] > 0) {
             tftPrint(ALEFT, "MF2", 162, 32, ActiveColor, ActiveColorSmooth, 16);
 
-            if (radio.eon[i + y].mappedfreq2 != mappedfreqold2[i + y]) {
+            if (radio.eon.mappedfreq2[e] != mappedfreqold2[i + y]) {
               char oldFreq2[10];
               dtostrf(mappedfreqold2[i + y] / 100.0, 5, 1, oldFreq2);
               tftPrint(ALEFT, oldFreq2, 160, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
             }
             char newFreq2[10];
-            dtostrf(radio.eon[i + y].mappedfreq2 / 100.0, 5, 1, newFreq2);
+            dtostrf(radio.eon.mappedfreq2[e] / 100.0, 5, 1, newFreq2);
             tftPrint(ALEFT, newFreq2, 160, 48 + (15 * i), RDSDropoutColor, RDSDropoutColorSmooth, 16);
-            mappedfreqold2[i + y] = radio.eon[i + y].mappedfreq2;
+            mappedfreqold2[i + y] = radio.eon.mappedfreq2[e];
           } else {
             char oldFreq2[10];
             dtostrf(mappedfreqold2[i + y] / 100.0, 5, 1, oldFreq2);
             tftPrint(ALEFT, oldFreq2, 160, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
           }
 
-          if (radio.eon[i + y].mappedfreq3 > 0) {
+          if (radio.eon.mappedfreq3[e] > 0) {
             tftPrint(ALEFT, "MF3", 207, 32, ActiveColor, ActiveColorSmooth, 16);
 
-            if (radio.eon[i + y].mappedfreq3 != mappedfreqold3[i + y]) {
+            if (radio.eon.mappedfreq3[e] != mappedfreqold3[i + y]) {
               char oldFreq3[10];
               dtostrf(mappedfreqold3[i + y] / 100.0, 5, 1, oldFreq3);
               tftPrint(ALEFT, oldFreq3, 205, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
             }
             char newFreq3[10];
-            dtostrf(radio.eon[i + y].mappedfreq3 / 100.0, 5, 1, newFreq3);
+            dtostrf(radio.eon.mappedfreq3[e] / 100.0, 5, 1, newFreq3);
             tftPrint(ALEFT, newFreq3, 205, 48 + (15 * i), RDSDropoutColor, RDSDropoutColorSmooth, 16);
-            mappedfreqold3[i + y] = radio.eon[i + y].mappedfreq3;
+            mappedfreqold3[i + y] = radio.eon.mappedfreq3[e];
           } else {
             char oldFreq3[10];
             dtostrf(mappedfreqold3[i + y] / 100.0, 5, 1, oldFreq3);
             tftPrint(ALEFT, oldFreq3, 205, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
           }
 
-          if (radio.eon[i + y].ptyset) {
-            if (eonptyold[i + y] != radio.eon[i + y].pty) tft.fillRect(290, 48 + (15 * i), 29, 16, BackgroundColor);
-            if (radio.eon[i + y].pty != 254) tftPrint(ARIGHT, String(radio.eon[i + y].pty), 310, 48 + (15 * i), RDSColor, RDSColorSmooth, 16);
-            eonptyold[i + y] = radio.eon[i + y].pty;
+          if (radio.eon.flag[e].ptyset) {
+            if (eonptyold[i + y] != radio.eon.pty[e]) tft.fillRect(290, 48 + (15 * i), 29, 16, BackgroundColor);
+            if (radio.eon.pty[e] != 254) tftPrint(ARIGHT, String(radio.eon.pty[e]), 310, 48 + (15 * i), RDSColor, RDSColorSmooth, 16);
+            eonptyold[i + y] = radio.eon.pty[e];
           } else {
             tft.fillRect(290, 48 + (15 * i), 29, 16, BackgroundColor);
           }
 
-          if (radio.eon[i + y].ta) tftPrint(ACENTER, "O", 250, 48 + (15 * i), RDSColor, RDSColorSmooth, 16); else tftPrint(ACENTER, "O", 250, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
-          if (radio.eon[i + y].tp) tftPrint(ACENTER, "O", 276, 48 + (15 * i), RDSColor, RDSColorSmooth, 16); else tftPrint(ACENTER, "O", 276, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
+          if (radio.eon.flag[e].ta) tftPrint(ACENTER, "O", 250, 48 + (15 * i), RDSColor, RDSColorSmooth, 16); else tftPrint(ACENTER, "O", 250, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
+          if (radio.eon.flag[e].tp) tftPrint(ACENTER, "O", 276, 48 + (15 * i), RDSColor, RDSColorSmooth, 16); else tftPrint(ACENTER, "O", 276, 48 + (15 * i), BackgroundColor, BackgroundColor, 16);
         }
       }
     }
@@ -36,6 +36,7 @@ extern bool RDSstatus;
 extern bool rdsstatscreen;
 extern bool rdsstereoold;
 extern bool rtcset;
+extern bool scandxmode;
 extern bool screenmute;
 extern bool setupmode;
 extern bool showclock;
@@ -46,6 +47,7 @@ extern bool wifi;
 extern bool XDRGTKTCP;
 extern bool XDRGTKUSB;
 extern byte af_counterold;
+extern byte eon_updatecounterold;
 extern byte aid_counterold;
 extern byte afpagenr;
 extern byte band;
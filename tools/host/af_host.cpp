@@ -0,0 +1,47 @@
+// Runs TEF6686::serviceAF() on the host against the simulated TEF668x:
+// the strongest AF carries a foreign PI and fails its check, then the
+// tuned station fades and the radio has to follow it to the other AF.
+// Build with make in this directory.
+#include <Arduino.h>
+#include "TEF6686.h"
+#include "Tuner_Sim.h"
+
+static TEF668xSim sim;
+static TEF6686 radio;
+
+int main() {
+  Tuner_SetBus(&sim);
+  sim.addStation(9870, 600, 50, 40, 0, 0x8201);
+  sim.addStation(9250, 800, 50, 40, 0, 0x8202);                           // Regional variant, not followed
+  sim.addStation(9050, 500, 50, 40, 0, 0x8201);
+  for (uint8_t i = 0; i < 32; i++) sim.queueRDS(0x8201, 0x0000 | (i & 3), (i & 1) ? (50 << 8 | 30) : ((0xE0 + 3) << 8 | 112), 0x2020, 0);
+
+  radio.init(102);
+  radio.SetFreq(9870);
+  radio.clearRDS(false);
+
+  unsigned long rejected = 0;
+  unsigned long faded = 0;
+  uint16_t switched = 0;
+  unsigned long start = millis();
+  while (millis() - start < 20000 && !switched) {
+    radio.readRDS(0);
+    if (radio.rds.correctPI) {
+      const quality_ &status = radio.getStatusIfOlderThan(TUNER_TASK_MAXAGE);
+      switched = radio.serviceAF(status.usn > 150 || status.wam > 150);
+    }
+    if (!rejected) {
+      for (uint8_t i = 0; i < radio.af_counter; i++) {
+        if (radio.af.frequency[i] == 9250 && !radio.af.flag[i].afvalid) rejected = millis();
+      }
+      if (rejected) printf("PI check of 9250 rejected after %lu ms\n", rejected - start);
+    } else if (!faded && millis() - rejected > AF_CHECK_SLOW + 500) {     // The next AF update has left its data in the chip
+      sim.setStation(9870, 250, 250, 200);
+      faded = millis();
+    }
+    delay(5);
+  }
+  printf("Switched to %u %lu ms after the fade, sim at %u, %u tunes\n", switched, faded ? millis() - faded : 0, sim.frequency, sim.tunes);
+  fflush(stdout);
+  _Exit(rejected && switched == 9050 && sim.frequency == 9050 ? 0 : 1);
+}
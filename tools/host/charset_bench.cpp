@@ -0,0 +1,290 @@
+// Compares TEF6686::RDScharConverter() with the conversion chain it
+// replaced: a switch into wchar_t, convertToUTF8() and
+// extractUTF8Substring(). Checks that both give the same text on random
+// input, then times them on PS and RT sized text. `make bench` runs it.
+#include <Arduino.h>
+#include <chrono>
+#include <random>
+#include "TEF6686.h"
+
+#define BENCH_CHECKS                200000                                // Random texts compared
+#define BENCH_RUNS                  1000000                               // Timed conversions per case
+
+// The old chain, as it was in TEF6686.cpp. The byte is read unsigned so
+// the upper half of the table is reached on hosts where char is signed.
+static void oldRDScharConverter(const char* input, wchar_t* output, size_t size, bool under) {
+  for (size_t i = 0; i < size - 1; i++) {
+    uint8_t currentChar = input[i];
+    switch (currentChar) {
+      case 0x0A: if (under) output[i] = L'_'; else output[i] = L' '; break;
+      case 0x20: if (under) output[i] = L'_'; else output[i] = L' '; break;
+      case 0x21 ... 0x5D: output[i] = static_cast<wchar_t>(currentChar); break;
+      case 0x5E: output[i] = L'―'; break;
+      case 0x5F: output[i] = L'_'; break;
+      case 0x60: output[i] = L'`'; break;
+      case 0x61 ... 0x7d: output[i] = static_cast<wchar_t>(currentChar); break;
+      case 0x7E: output[i] = L'¯'; break;
+      case 0x7F: output[i] = L' '; break;
+      case 0x80: output[i] = L'á'; break;
+      case 0x81: output[i] = L'à'; break;
+      case 0x82: output[i] = L'é'; break;
+      case 0x83: output[i] = L'è'; break;
+      case 0x84: output[i] = L'í'; break;
+      case 0x85: output[i] = L'ì'; break;
+      case 0x86: output[i] = L'ó'; break;
+      case 0x87: output[i] = L'ò'; break;
+      case 0x88: output[i] = L'ú'; break;
+      case 0x89: output[i] = L'ù'; break;
+      case 0x8A: output[i] = L'Ñ'; break;
+      case 0x8B: output[i] = L'Ç'; break;
+      case 0x8C: output[i] = L'Ş'; break;
+      case 0x8D: output[i] = L'β'; break;
+      case 0x8E: output[i] = L'¡'; break;
+      case 0x8F: output[i] = L'Ĳ'; break;
+      case 0x90: output[i] = L'â'; break;
+      case 0x91: output[i] = L'ä'; break;
+      case 0x92: output[i] = L'ê'; break;
+      case 0x93: output[i] = L'ë'; break;
+      case 0x94: output[i] = L'î'; break;
+      case 0x95: output[i] = L'ï'; break;
+      case 0x96: output[i] = L'ô'; break;
+      case 0x97: output[i] = L'ö'; break;
+      case 0x98: output[i] = L'û'; break;
+      case 0x99: output[i] = L'ü'; break;
+      case 0x9A: output[i] = L'ñ'; break;
+      case 0x9B: output[i] = L'ç'; break;
+      case 0x9C: output[i] = L'ş'; break;
+      case 0x9D: output[i] = L'ǧ'; break;
+      case 0x9E: output[i] = L'ı'; break;
+      case 0x9F: output[i] = L'ĳ'; break;
+      case 0xA0: output[i] = L'ª'; break;
+      case 0xA1: output[i] = L'α'; break;
+      case 0xA2: output[i] = L'©'; break;
+      case 0xA3: output[i] = L'‰'; break;
+      case 0xA4: output[i] = L'Ǧ'; break;
+      case 0xA5: output[i] = L'ě'; break;
+      case 0xA6: output[i] = L'ň'; break;
+      case 0xA7: output[i] = L'ő'; break;
+      case 0xA8: output[i] = L'π'; break;
+      case 0xA9: output[i] = L'€'; break;
+      case 0xAA: output[i] = L'£'; break;
+      case 0xAB: output[i] = L'$'; break;
+      case 0xAC: output[i] = L'←'; break;
+      case 0xAD: output[i] = L'↑'; break;
+      case 0xAE: output[i] = L'→'; break;
+      case 0xAF: output[i] = L'↓'; break;
+      case 0xB0: output[i] = L'º'; break;
+      case 0xB1: output[i] = L'¹'; break;
+      case 0xB2: output[i] = L'²'; break;
+      case 0xB3: output[i] = L'³'; break;
+      case 0xB4: output[i] = L'±'; break;
+      case 0xB5: output[i] = L'İ'; break;
+      case 0xB6: output[i] = L'ń'; break;
+      case 0xB7: output[i] = L'ű'; break;
+      case 0xB8: output[i] = L'µ'; break;
+      case 0xB9: output[i] = L'¿'; break;
+      case 0xBA: output[i] = L'÷'; break;
+      case 0xBB: output[i] = L'°'; break;
+      case 0xBC: output[i] = L'¼'; break;
+      case 0xBD: output[i] = L'½'; break;
+      case 0xBE: output[i] = L'¾'; break;
+      case 0xBF: output[i] = L'§'; break;
+      case 0xC0: output[i] = L'Á'; break;
+      case 0xC1: output[i] = L'À'; break;
+      case 0xC2: output[i] = L'É'; break;
+      case 0xC3: output[i] = L'È'; break;
+      case 0xC4: output[i] = L'Í'; break;
+      case 0xC5: output[i] = L'Ì'; break;
+      case 0xC6: output[i] = L'Ó'; break;
+      case 0xC7: output[i] = L'Ò'; break;
+      case 0xC8: output[i] = L'Ú'; break;
+      case 0xC9: output[i] = L'Ù'; break;
+      case 0xCA: output[i] = L'Ř'; break;
+      case 0xCB: output[i] = L'Č'; break;
+      case 0xCC: output[i] = L'Š'; break;
+      case 0xCD: output[i] = L'Ž'; break;
+      case 0xCE: output[i] = L'Ð'; break;
+      case 0xCF: output[i] = L'Ŀ'; break;
+      case 0xD0: output[i] = L'Â'; break;
+      case 0xD1: output[i] = L'Ä'; break;
+      case 0xD2: output[i] = L'Ê'; break;
+      case 0xD3: output[i] = L'Ë'; break;
+      case 0xD4: output[i] = L'Î'; break;
+      case 0xD5: output[i] = L'Ï'; break;
+      case 0xD6: output[i] = L'Ô'; break;
+      case 0xD7: output[i] = L'Ö'; break;
+      case 0xD8: output[i] = L'Û'; break;
+      case 0xD9: output[i] = L'Ü'; break;
+      case 0xDA: output[i] = L'ř'; break;
+      case 0xDB: output[i] = L'č'; break;
+      case 0xDC: output[i] = L'š'; break;
+      case 0xDD: output[i] = L'ž'; break;
+      case 0xDE: output[i] = L'đ'; break;
+      case 0xDF: output[i] = L'ŀ'; break;
+      case 0xE0: output[i] = L'Ã'; break;
+      case 0xE1: output[i] = L'Å'; break;
+      case 0xE2: output[i] = L'Æ'; break;
+      case 0xE3: output[i] = L'Œ'; break;
+      case 0xE4: output[i] = L'ŷ'; break;
+      case 0xE5: output[i] = L'Ý'; break;
+      case 0xE6: output[i] = L'Õ'; break;
+      case 0xE7: output[i] = L'Ø'; break;
+      case 0xE8: output[i] = L'Þ'; break;
+      case 0xE9: output[i] = L'Ŋ'; break;
+      case 0xEA: output[i] = L'Ŕ'; break;
+      case 0xEB: output[i] = L'Ć'; break;
+      case 0xEC: output[i] = L'Ś'; break;
+      case 0xED: output[i] = L'Ź'; break;
+      case 0xEE: output[i] = L'Ŧ'; break;
+      case 0xEF: output[i] = L'ð'; break;
+      case 0xF0: output[i] = L'ã'; break;
+      case 0xF1: output[i] = L'å'; break;
+      case 0xF2: output[i] = L'æ'; break;
+      case 0xF3: output[i] = L'œ'; break;
+      case 0xF4: output[i] = L'ŵ'; break;
+      case 0xF5: output[i] = L'ý'; break;
+      case 0xF6: output[i] = L'õ'; break;
+      case 0xF7: output[i] = L'ø'; break;
+      case 0xF8: output[i] = L'þ'; break;
+      case 0xF9: output[i] = L'ŋ'; break;
+      case 0xFA: output[i] = L'ŕ'; break;
+      case 0xFB: output[i] = L'ć'; break;
+      case 0xFC: output[i] = L'ś'; break;
+      case 0xFD: output[i] = L'ź'; break;
+      case 0xFE: output[i] = L'ŧ'; break;
+      case 0xFF: output[i] = L' '; break;
+    }
+  }
+  output[size - 1] = L'\0';
+}
+
+static uint16_t oldconvertToUTF8(const wchar_t* input, char* output, uint16_t size) {
+  uint16_t length = 0;
+  while (*input) {
+    uint32_t unicode = *input;
+    uint8_t bytes = (unicode < 0x80) ? 1 : (unicode < 0x800) ? 2 : (unicode < 0x10000) ? 3 : 4;
+    if (length + bytes >= size) break;
+    if (unicode < 0x80) {
+      output[length++] = (char)unicode;
+    } else if (unicode < 0x800) {
+      output[length++] = (char)(0xC0 | (unicode >> 6));
+      output[length++] = (char)(0x80 | (unicode & 0x3F));
+    } else if (unicode < 0x10000) {
+      output[length++] = (char)(0xE0 | (unicode >> 12));
+      output[length++] = (char)(0x80 | ((unicode >> 6) & 0x3F));
+      output[length++] = (char)(0x80 | (unicode & 0x3F));
+    } else {
+      output[length++] = (char)(0xF0 | (unicode >> 18));
+      output[length++] = (char)(0x80 | ((unicode >> 12) & 0x3F));
+      output[length++] = (char)(0x80 | ((unicode >> 6) & 0x3F));
+      output[length++] = (char)(0x80 | (unicode & 0x3F));
+    }
+    input++;
+  }
+  output[length] = '\0';
+  return length;
+}
+
+static uint16_t oldextractUTF8Substring(char* utf8String, uint16_t size, size_t start, size_t length, bool under) {
+  size_t utf8Length = strlen(utf8String);
+  size_t utf8Index = 0;
+  size_t charIndex = 0;
+  uint16_t substring = 0;
+
+  while (utf8Index < utf8Length && charIndex < start + length) {
+    uint8_t currentByte = utf8String[utf8Index];
+    uint8_t numBytes = 1;
+
+    if ((currentByte >> 5) == 0x6) {
+      numBytes = 2;
+    } else if ((currentByte >> 4) == 0xE) {
+      numBytes = 3;
+    } else if ((currentByte >> 3) == 0x1E) {
+      numBytes = 4;
+    }
+    if (utf8Index + numBytes > utf8Length) break;
+
+    if (charIndex >= start) {
+      memmove(utf8String + substring, utf8String + utf8Index, numBytes);
+      substring += numBytes;
+    }
+
+    utf8Index += numBytes;
+    charIndex++;
+  }
+
+  if (under) {
+    while (substring < length && substring < size - 1) {
+      utf8String[substring++] = '_';
+    }
+  }
+
+  utf8String[substring] = '\0';
+  return substring;
+}
+
+static uint16_t oldChain(const char* input, size_t length, char* output, uint16_t size, bool under) {
+  wchar_t text[65] = L"";
+  oldRDScharConverter(input, text, length + 1, under);
+  oldconvertToUTF8(text, output, size);
+  return oldextractUTF8Substring(output, size, 0, length, under);
+}
+
+static void randomText(std::mt19937 &rng, char* text, size_t length, bool printable, bool ascii) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t code;
+    do {
+      code = rng();
+    } while ((printable && RDScharset[code].length == 0) || (ascii && RDScharset[code].length > 1));
+    text[i] = code;
+  }
+  text[length] = '\0';
+}
+
+// Under set pads to length bytes in the old chain and length characters
+// in the new one, so it is only compared on ASCII text.
+static uint32_t check(std::mt19937 &rng, size_t length, bool under) {
+  char text[65];
+  char oldutf8[64 * RDS_UTF8_MAX + 1];
+  char newutf8[64 * RDS_UTF8_MAX + 1];
+  uint32_t mismatch = 0;
+
+  for (uint32_t i = 0; i < BENCH_CHECKS; i++) {
+    randomText(rng, text, length, i & 1, under);
+    uint16_t oldlength = oldChain(text, length, oldutf8, length * RDS_UTF8_MAX + 1, under);
+    uint16_t newlength = TEF6686::RDScharConverter(text, length, newutf8, length * RDS_UTF8_MAX + 1, under);
+    if (oldlength != newlength || strcmp(oldutf8, newutf8) != 0) mismatch++;
+  }
+  return mismatch;
+}
+
+template <typename convert_>
+static double timeRuns(const char (*texts)[65], size_t length, convert_ convert) {
+  char utf8[64 * RDS_UTF8_MAX + 1];
+  volatile uint32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < BENCH_RUNS; i++) sink += convert(texts[i & 63], length, utf8, length * RDS_UTF8_MAX + 1, false);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_RUNS;
+}
+
+int main() {
+  std::mt19937 rng(6686);
+  static char texts[64][65];
+  uint32_t mismatch = 0;
+  const size_t lengths[] = {8, 64};
+
+  for (size_t length : lengths) {
+    mismatch += check(rng, length, false);
+    mismatch += check(rng, length, true);
+  }
+  printf("%u of %u random texts differ\n", mismatch, 4 * BENCH_CHECKS);
+
+  for (size_t length : lengths) {
+    for (uint8_t i = 0; i < 64; i++) randomText(rng, texts[i], length, true, false);
+    double oldns = timeRuns(texts, length, oldChain);
+    double newns = timeRuns(texts, length, TEF6686::RDScharConverter);
+    printf("%2zu characters: old chain %.0f ns, table %.0f ns\n", length, oldns, newns);
+  }
+  return mismatch ? 1 : 0;
+}
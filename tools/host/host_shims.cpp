@@ -0,0 +1,34 @@
+// Arduino timing and the bus objects for the host programs in this
+// directory.
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPIFFS.h>
+#include <chrono>
+#include <thread>
+
+static auto hoststart = std::chrono::steady_clock::now();
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hoststart).count();
+}
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+int analogRead(int) {
+  return 0;
+}
+
+void yield() {}
+
+TwoWire Wire;
+fs::FS SPIFFS;
@@ -0,0 +1,76 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <algorithm>
+#include "freertos_stub.h"
+typedef uint8_t byte;
+typedef bool boolean;
+#define PROGMEM
+#define F(x) x
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define bitRead(v,b) (((v) >> (b)) & 1)
+#define constrain(a,l,h) ((a)<(l)?(l):((a)>(h)?(h):(a)))
+#define log_d(...) do{}while(0)
+#define log_i(...) do{}while(0)
+#define log_e(...) do{}while(0)
+#define log_w(...) do{}while(0)
+#define HEX 16
+#define DEC 10
+#define IRAM_ATTR
+unsigned long millis(); unsigned long micros(); void delay(unsigned long); void delayMicroseconds(unsigned int); int analogRead(int);
+void yield();
+static inline size_t strlcpy(char *d, const char *s, size_t n) { size_t l = strlen(s); if (n) { size_t c = l < n - 1 ? l : n - 1; memcpy(d, s, c); d[c] = 0; } return l; }
+class String {
+public:
+  std::string s;
+  String() {}
+  String(const char *c) : s(c ? c : "") {}
+  String(const std::string &c) : s(c) {}
+  String(char c) : s(1, c) {}
+  String(int v, int base = 10) { char b[34]; if (base==16) snprintf(b,34,"%x",v); else snprintf(b,34,"%d",v); s=b; }
+  String(unsigned v, int base = 10) { char b[34]; if (base==16) snprintf(b,34,"%x",v); else snprintf(b,34,"%u",v); s=b; }
+  String(long v, int base = 10) : String((int)v, base) {}
+  String(unsigned long v, int base = 10) : String((unsigned)v, base) {}
+  String(double v, int d = 2) { char b[40]; snprintf(b,40,"%.*f",d,v); s=b; }
+  unsigned length() const { return s.size(); }
+  const char *c_str() const { return s.c_str(); }
+  char charAt(unsigned i) const { return i < s.size() ? s[i] : 0; }
+  char operator[](unsigned i) const { return charAt(i); }
+  char &operator[](unsigned i) { return s[i]; }
+  String substring(unsigned a) const { return a < s.size() ? String(s.substr(a)) : String(); }
+  String substring(unsigned a, unsigned b) const { return a < s.size() && b > a ? String(s.substr(a, b - a)) : String(); }
+  int indexOf(char c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String &c, unsigned from = 0) const { auto p = s.find(c.s, from); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(char c) const { auto p = s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+  void toCharArray(char *b, unsigned n) const { strncpy(b, s.c_str(), n); if (n) b[n-1] = 0; }
+  void getBytes(unsigned char *b, unsigned n) const { toCharArray((char*)b, n); }
+  long toInt() const { return atol(s.c_str()); }
+  void trim() {}
+  void replace(const String &, const String &) {}
+  void remove(unsigned i) { if (i < s.size()) s.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < s.size()) s.erase(i, n); }
+  void reserve(unsigned n) { s.reserve(n); }
+  void toUpperCase() {}
+  bool startsWith(const String &p) const { return s.rfind(p.s, 0) == 0; }
+  bool endsWith(const String &p) const { return s.size() >= p.s.size() && s.compare(s.size()-p.s.size(), p.s.size(), p.s) == 0; }
+  bool equals(const String &o) const { return s == o.s; }
+  void setCharAt(unsigned i, char c) { if (i < s.size()) s[i] = c; }
+  String &operator+=(const String &o) { s += o.s; return *this; }
+  String &operator+=(const char *o) { s += o; return *this; }
+  String &operator+=(char o) { s += o; return *this; }
+  bool operator==(const String &o) const { return s == o.s; }
+  bool operator==(const char *o) const { return s == o; }
+  bool operator!=(const String &o) const { return s != o.s; }
+  bool operator!=(const char *o) const { return s != o; }
+  bool operator<(const String &o) const { return s < o.s; }
+  friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+  friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+  friend String operator+(const String &a, char b) { return String(a.s + b); }
+};
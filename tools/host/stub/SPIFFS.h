@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+#include <stdio.h>
+#include <memory>
+namespace fs {
+struct File {
+  std::shared_ptr<FILE> f;
+  File() {}
+  File(FILE *p) : f(p, [](FILE *x){ if (x) fclose(x); }) {}
+  int available(){ if(!f) return 0; long p=ftell(f.get()); fseek(f.get(),0,SEEK_END); long e=ftell(f.get()); fseek(f.get(),p,SEEK_SET); return e-p; }
+  int read(){ return f ? fgetc(f.get()) : -1; }
+  int peek(){ if(!f) return -1; int c=fgetc(f.get()); if(c!=EOF) ungetc(c,f.get()); return c; }
+  size_t readBytesUntil(char t,char*b,size_t n){ size_t i=0; while(i<n){ int c=read(); if(c<0||c==t) break; b[i++]=c; } return i; }
+  size_t read(uint8_t*b,size_t n){ return f ? fread(b,1,n,f.get()) : 0; }
+  size_t write(const uint8_t*b,size_t n){ return f ? fwrite(b,1,n,f.get()) : 0; }
+  size_t size(){ if(!f) return 0; long p=ftell(f.get()); fseek(f.get(),0,SEEK_END); long e=ftell(f.get()); fseek(f.get(),p,SEEK_SET); return e; }
+  bool seek(uint32_t p){ return f && fseek(f.get(),p,SEEK_SET)==0; }
+  void close(){ f.reset(); }
+  void flush(){ if(f) fflush(f.get()); }
+  operator bool() const { return (bool)f; }
+  String readStringUntil(char){return String();}
+  size_t position(){ return f ? ftell(f.get()) : 0; }
+};
+struct FS {
+  static std::string p(const char*n){ return std::string("spiffs") + n; }
+  bool begin(bool=false){ return true; }
+  File open(const char*n, const char* m="r"){ std::string mm = m; if (mm=="r") mm="rb"; else if (mm=="w") mm="wb"; else if (mm=="a") mm="ab"; return File(fopen(p(n).c_str(), mm.c_str())); }
+  File open(const String&n, const char* m="r"){ return open(n.c_str(), m); }
+  bool exists(const char*n){ FILE*x=fopen(p(n).c_str(),"rb"); if(x) fclose(x); return x; }
+  bool remove(const char*n){ return ::remove(p(n).c_str())==0; }
+  size_t totalBytes(){ return 1<<20; }
+  size_t usedBytes(){ return 0; }
+};
+}
+extern fs::FS SPIFFS;
@@ -0,0 +1,4 @@
+#pragma once
+#include <Arduino.h>
+struct TwoWire { void begin(int a=0,int b=0){} void setClock(uint32_t){} void beginTransmission(uint8_t){} uint8_t endTransmission(bool s=true){return 0;} size_t write(uint8_t){return 1;} size_t write(const uint8_t*,size_t n){return n;} uint8_t requestFrom(uint8_t,size_t n){return n;} int read(){return 0;} int available(){return 0;} };
+extern TwoWire Wire;
@@ -0,0 +1,29 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+typedef int BaseType_t; typedef unsigned UBaseType_t; typedef uint32_t TickType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffu
+#define pdMS_TO_TICKS(x) (x)
+struct StubTask { std::mutex m; std::condition_variable cv; bool note = false; };
+typedef StubTask *TaskHandle_t;
+inline TaskHandle_t &stub_current() { static thread_local StubTask *t = nullptr; return t; }
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { if (!stub_current()) stub_current() = new StubTask; return stub_current(); }
+inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *, uint32_t, void *arg, UBaseType_t, TaskHandle_t *h, BaseType_t) {
+  StubTask *t = new StubTask; if (h) *h = t;
+  std::thread([=] { stub_current() = t; fn(arg); }).detach(); return pdPASS; }
+inline void xTaskNotifyGive(TaskHandle_t t) { std::lock_guard<std::mutex> l(t->m); t->note = true; t->cv.notify_one(); }
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t ticks) { StubTask *t = xTaskGetCurrentTaskHandle(); std::unique_lock<std::mutex> l(t->m);
+  t->cv.wait_for(l, std::chrono::milliseconds(ticks), [&] { return t->note; }); bool n = t->note; t->note = false; return n; }
+inline void vTaskDelay(TickType_t t) { std::this_thread::sleep_for(std::chrono::milliseconds(t)); }
+struct StubSem { std::recursive_mutex m; std::atomic<StubTask *> holder{nullptr}; int depth = 0; };
+typedef StubSem *SemaphoreHandle_t;
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new StubSem; }
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t) { s->m.lock(); s->holder = xTaskGetCurrentTaskHandle(); s->depth++; return pdTRUE; }
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) { if (--s->depth == 0) s->holder = nullptr; s->m.unlock(); return pdTRUE; }
+inline TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t s) { return s->holder; }
@@ -0,0 +1,36 @@
+// Runs the tuner layer on the host against the simulated TEF668x: boots
+// the chip, tunes a scripted station and decodes its PI and PS with
+// TEF6686::readRDS(). Build with make in this directory.
+#include <Arduino.h>
+#include "TEF6686.h"
+#include "Tuner_Sim.h"
+
+static TEF668xSim sim;
+static TEF6686 radio;
+
+int main() {
+  const char ps[] = "HOST FM ";
+
+  Tuner_SetBus(&sim);
+  sim.addStation(9870, 550, 50, 40, 0, 0x8201);
+  for (uint8_t i = 0; i < 16; i++) sim.queueRDS(0x8201, 0x0400 | (i & 3), 0xE0CD, (ps[(i & 3) * 2] << 8) | ps[(i & 3) * 2 + 1], 0);
+
+  unsigned long start = millis();
+  radio.init(102);
+  printf("Boot %lu ms\n", millis() - start);
+
+  start = millis();
+  radio.SetFreq(9870);
+  radio.waitTune();
+  printf("Tuned %u in %lu ms, level %d USN %u WAM %u\n", sim.frequency, millis() - start, radio.quality.level, radio.quality.usn, radio.quality.wam);
+
+  radio.clearRDS(false);
+  start = millis();
+  while (millis() - start < 2000 && !radio.ps_process) {
+    radio.readRDS(0);
+    delay(5);
+  }
+  printf("PI %04X PS \"%s\" after %lu ms, %u groups, %u lost\n", radio.rds.correctPI, radio.rds.stationName.c_str(), millis() - start, sim.rdsdelivered, sim.rdslost);
+  fflush(stdout);
+  _Exit(radio.ps_process && strcmp(radio.rds.stationName.c_str(), ps) == 0 ? 0 : 1);
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""Pack the TEF668x Lithio patch images for src/Tuner_Patch_Lithio_*.h.
+
+The patch array is stored LZSS compressed and expanded on the fly by
+Tuner_Patch_Unpack() in src/Tuner_Interface.cpp while it is streamed to the
+tuner. The LUT arrays are too small to gain anything and stay raw.
+
+Stream format, must match Tuner_Interface.cpp:
+  - a flag byte announces the next 8 items, LSB first
+  - flag 1: one literal byte
+  - flag 0: two bytes, big endian: distance - 1 (10 bits) | length - 3 (6 bits)
+    copying from the last LZ_WINDOW bytes of output
+
+Every run decodes its own output and checks it against the input (and the
+CRC32 written to the header) before anything is written.
+
+  patch_packer.py pack <raw header or .bin> <version> <out header> [--lut <raw header or .bin>]
+  patch_packer.py unpack <packed header> <version> <out .bin>
+  patch_packer.py check <packed header> <version>
+"""
+
+import argparse
+import re
+import sys
+import zlib
+
+LZ_WINDOW = 1024
+LZ_MIN = 3
+LZ_MAX = LZ_MIN + 63
+
+
+def compress(data):
+    out = bytearray()
+    chains = {}
+    pos = 0
+    items = []
+
+    while pos < len(data):
+        best_len = 0
+        best_dist = 0
+        key = bytes(data[pos:pos + LZ_MIN])
+        for cand in reversed(chains.get(key, [])):
+            if pos - cand > LZ_WINDOW:
+                break
+            length = 0
+            while length < LZ_MAX and pos + length < len(data) and data[cand + length] == data[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len = length
+                best_dist = pos - cand
+                if length == LZ_MAX:
+                    break
+
+        step = best_len if best_len >= LZ_MIN else 1
+        if best_len >= LZ_MIN:
+            items.append((best_dist, best_len))
+        else:
+            items.append(data[pos])
+        for i in range(pos, pos + step):
+            if i + LZ_MIN <= len(data):
+                chains.setdefault(bytes(data[i:i + LZ_MIN]), []).append(i)
+        pos += step
+
+    for group in range(0, len(items), 8):
+        flags = 0
+        body = bytearray()
+        for bit, item in enumerate(items[group:group + 8]):
+            if isinstance(item, int):
+                flags |= 1 << bit
+                body.append(item)
+            else:
+                dist, length = item
+                token = ((dist - 1) << 6) | (length - LZ_MIN)
+                body += bytes((token >> 8, token & 0xFF))
+        out.append(flags)
+        out += body
+    return bytes(out)
+
+
+def decompress(packed, size):
+    out = bytearray()
+    pos = 0
+    flags = 0
+    bits = 0
+    while len(out) < size:
+        if bits == 0:
+            flags = packed[pos]
+            pos += 1
+            bits = 8
+        if flags & 1:
+            out.append(packed[pos])
+            pos += 1
+        else:
+            token = (packed[pos] << 8) | packed[pos + 1]
+            pos += 2
+            dist = (token >> 6) + 1
+            for _ in range((token & 0x3F) + LZ_MIN):
+                out.append(out[-dist])
+        flags >>= 1
+        bits -= 1
+    return bytes(out)
+
+
+def read_array(path, name):
+    if path.endswith(".bin"):
+        with open(path, "rb") as f:
+            return f.read()
+    with open(path, newline="") as f:
+        text = f.read()
+    match = re.search(name + r"\[\] PROGMEM = \{(.*?)\};", text, re.S)
+    if not match:
+        sys.exit("%s: no %s array" % (path, name))
+    return bytes(int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", match.group(1)))
+
+
+def read_const(path, name):
+    with open(path, newline="") as f:
+        match = re.search(r"const \w+ " + name + r" = (0x[0-9A-Fa-f]+|\d+);", f.read())
+    if not match:
+        sys.exit("%s: no %s constant" % (path, name))
+    return int(match.group(1), 0)
+
+
+def c_array(data, per_line):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + per_line]))
+    return ",\r\n".join(lines)
+
+
+def pack(args):
+    raw = read_array(args.input, "PatchByteValues" + args.version)
+    lut = read_array(args.lut or args.input, "LutByteValues" + args.version)
+    packed = compress(raw)
+    if decompress(packed, len(raw)) != raw:
+        sys.exit("round trip failed, nothing written")
+    crc = zlib.crc32(raw) & 0xFFFFFFFF
+    v = args.version
+
+    text = "\r\n".join([
+        "// Generated by tools/patch_packer.py, LZSS packed (%d -> %d bytes)" % (len(raw), len(packed)),
+        "extern const size_t PatchSize%s;" % v,
+        "extern const size_t PatchPackedSize%s;" % v,
+        "extern const uint32_t PatchCrc%s;" % v,
+        "extern const unsigned char *pPatchBytes%s;" % v,
+        "static const unsigned char PatchByteValues%s[] PROGMEM = {" % v,
+        c_array(packed, 24),
+        "};",
+        "",
+        "const size_t PatchSize%s = %d;" % (v, len(raw)),
+        "const size_t PatchPackedSize%s = sizeof(PatchByteValues%s);" % (v, v),
+        "const uint32_t PatchCrc%s = 0x%08X;" % (v, crc),
+        "const unsigned char * pPatchBytes%s = &PatchByteValues%s[0];" % (v, v),
+        "",
+        "extern const size_t LutSize%s;" % v,
+        "extern const unsigned char * pLutBytes%s;" % v,
+        "static const unsigned char LutByteValues%s[] PROGMEM = {" % v,
+        c_array(lut, 8),
+        "};",
+        "",
+        "const size_t LutSize%s = sizeof(LutByteValues%s);" % (v, v),
+        "const unsigned char *pLutBytes%s = &LutByteValues%s[0];" % (v, v),
+        "",
+    ])
+    with open(args.output, "w", newline="") as f:
+        f.write(text)
+    print("V%s patch %d -> %d bytes (%.0f%%), crc32 %08X" % (v, len(raw), len(packed), 100.0 * len(packed) / len(raw), crc))
+
+
+def unpack_header(path, version):
+    packed = read_array(path, "PatchByteValues" + version)
+    size = read_const(path, "PatchSize" + version)
+    raw = decompress(packed, size)
+    if zlib.crc32(raw) & 0xFFFFFFFF != read_const(path, "PatchCrc" + version):
+        sys.exit("%s: CRC mismatch" % path)
+    if compress(raw) != packed:
+        print("note: %s was packed by a different encoder" % path)
+    return raw
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+    p = sub.add_parser("pack")
+    p.add_argument("input")
+    p.add_argument("version")
+    p.add_argument("output")
+    p.add_argument("--lut")
+    p = sub.add_parser("unpack")
+    p.add_argument("input")
+    p.add_argument("version")
+    p.add_argument("output")
+    p = sub.add_parser("check")
+    p.add_argument("input")
+    p.add_argument("version")
+    args = parser.parse_args()
+
+    if args.cmd == "pack":
+        pack(args)
+    elif args.cmd == "unpack":
+        with open(args.output, "wb") as f:
+            f.write(unpack_header(args.input, args.version))
+    else:
+        raw = unpack_header(args.input, args.version)
+        print("%s: V%s patch %d bytes, round trip OK" % (args.input, args.version, len(raw)))
+
+
+if __name__ == "__main__":
+    main()